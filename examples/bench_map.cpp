@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_map.h>
+#include <chrono>
+#include <cstdio>
+
+// ---------------------
+// GPU Hashmap Benchmark
+// ---------------------
+
+static unsigned int bench_key(int i) {
+    // Scatter Keys like Hashed Names
+    unsigned int x = (unsigned int) i * 0x9E3779B1u;
+    return (x ^ (x >> 15)) | 1;
+}
+
+static double bench_elapsed(std::chrono::steady_clock::time_point start, long long ops) {
+    std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+    return ns.count() / (double) ops;
+}
+
+static void bench_size(int count) {
+    const long long rounds = (1 << 22) / count + 1;
+    double insert_ns = 0.0;
+    double lookup_ns = 0.0;
+    unsigned long long sum = 0;
+
+    // Measure Insert on Fresh Maps
+    for (long long r = 0; r < rounds; r++) {
+        GPUHashmap<int> map;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; i++)
+            map.add_key(bench_key(i), i);
+        insert_ns += bench_elapsed(start, count);
+    }
+
+    // Measure Lookup on a Filled Map
+    GPUHashmap<int> map;
+    for (int i = 0; i < count; i++)
+        map.add_key(bench_key(i), i);
+    auto start = std::chrono::steady_clock::now();
+    for (long long r = 0; r < rounds; r++)
+        for (int i = 0; i < count; i++)
+            sum += *map.get_key(bench_key(i));
+    lookup_ns = bench_elapsed(start, rounds * count);
+
+    printf("%8d entries: insert %6.2f ns/op, lookup %6.2f ns/op (%llu)\n",
+        count, insert_ns / (double) rounds, lookup_ns, sum & 0xF);
+}
+
+static bool bench_inline() {
+    GPUHashmapOpaque::resetCounters();
+    // Typical Program Uniforms and Framebuffer Colors
+    GPUHashmap<void*, 12> uniforms;
+    GPUHashmap<int, 4> colors;
+    for (int i = 0; i < 12; i++)
+        uniforms.add_key(bench_key(i), nullptr);
+    for (int i = 0; i < 4; i++)
+        colors.add_key(bench_key(i), i);
+
+    // Inline Capacity Avoids Heap Traffic
+    GPUHashmapCounters heap = GPUHashmapOpaque::counters();
+    printf("typical maps: %u allocs, %u reallocs, %u frees\n",
+        heap.allocs, heap.reallocs, heap.frees);
+    return heap.allocs == 0 && heap.reallocs == 0;
+}
+
+int main() {
+    if (!bench_inline()) {
+        printf("typical maps touched the heap\n");
+        return 1;
+    }
+
+    // Flat Cost per Operation Shows O(1)
+    for (int count = 16; count <= 65536; count <<= 2)
+        bench_size(count);
+    return 0;
+}
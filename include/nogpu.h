@@ -4,6 +4,7 @@
 #define NOGPU_H
 
 #include "nogpu/device.h" // IWYU pragma: export
+#include "nogpu/name.h" // IWYU pragma: export
 #include "nogpu/buffer.h" // IWYU pragma: export
 #include "nogpu/texture.h" // IWYU pragma: export
 #include "nogpu/compressed.h" // IWYU pragma: export
@@ -49,6 +49,27 @@ class GPUBuffer {
         virtual void unmap() = 0;
 };
 
+// --------------------------
+// GPU Objects: Stream Buffer
+// --------------------------
+
+typedef struct {
+    void* data;
+    GPUBuffer* buffer;
+    int offset;
+} GPUStreamAllocation;
+
+class GPUStreamBuffer {
+    protected: int m_bytes;
+    public: virtual void destroy() = 0;
+    public: int getBytes() { return m_bytes; };
+
+    public: // GPU Stream Buffer Usage
+        virtual GPUStreamAllocation allocate(int bytes, int alignment) = 0;
+        virtual void advance() = 0;
+        virtual GPUBuffer* getBuffer() = 0;
+};
+
 // -------------------------
 // GPU Objects: Vertex Array
 // -------------------------
@@ -7,6 +7,7 @@ enum class GPUBlockBinding : int {
     BLOCK_BUFFER_OBJECT,
     BLOCK_SHADER_STORAGE,
     BLOCK_ATOMIC_COUNTER,
+    BLOCK_SHADER_STORAGE_READONLY,
 };
 
 // -----------------------
@@ -47,6 +48,64 @@ class GPUFence {
         virtual bool completed() = 0;
 };
 
+typedef void (*GPUFenceCallback)(void* userdata);
+class GPUFenceQueue {
+    public: // Fence Completion Queue
+        virtual void destroy() = 0;
+        virtual void push(GPUFence* fence, GPUFenceCallback cb, void* userdata) = 0;
+        virtual int poll() = 0;
+        virtual void finish() = 0;
+};
+
+// -------------------------
+// GPU Context: Timer Queries
+// -------------------------
+
+typedef struct {
+    const char* label;
+    int depth, parent;
+    // Scope Durations
+    unsigned long long gpu_ns;
+    unsigned long long cpu_ns;
+    // Scope Begin on CPU Clock
+    unsigned long long gpu_begin;
+    unsigned long long cpu_begin;
+} GPUTimerScope;
+
+typedef struct {
+    GPUTimerScope* scopes;
+    int count;
+    unsigned long long frame;
+} GPUTimerTable;
+
+// -------------------------
+// GPU Context: Query Objects
+// -------------------------
+
+enum class GPUQueryType : int {
+    QUERY_OCCLUSION,
+    QUERY_PRIMITIVES_GENERATED,
+    // Pipeline Statistics
+    QUERY_VERTICES_SUBMITTED,
+    QUERY_PRIMITIVES_SUBMITTED,
+    QUERY_VERTEX_SHADER_INVOCATIONS,
+    QUERY_TESS_CONTROL_PATCHES,
+    QUERY_TESS_EVALUATION_INVOCATIONS,
+    QUERY_GEOMETRY_PRIMITIVES_EMITTED,
+    QUERY_FRAGMENT_SHADER_INVOCATIONS,
+    QUERY_COMPUTE_SHADER_INVOCATIONS,
+    QUERY_CLIPPING_INPUT_PRIMITIVES,
+    QUERY_CLIPPING_OUTPUT_PRIMITIVES,
+};
+
+class GPUQuery {
+    public: // Query Result
+        virtual void destroy() = 0;
+        virtual bool available() = 0;
+        virtual unsigned long long result() = 0;
+        virtual GPUQueryType getType() = 0;
+};
+
 enum class GPUMemoryBarrier : int {
     BARRIER_BUFFER = 1 << 0,
     BARRIER_TEXTURE = 1 << 1,
@@ -64,6 +123,7 @@ class GPUPipeline;
 class GPUVertexArray;
 class GPUBuffer;
 class GPUTexture;
+class GPUUniform;
 class GPUFrameBuffer;
 class GPUCommands {
     public: // GPU Command Issue
@@ -74,6 +134,14 @@ class GPUCommands {
         virtual void syncFlush() = 0;
         virtual void syncFinish() = 0;
         virtual GPUFence* syncFence() = 0;
+    public: // GPU Command Timer
+        virtual void beginTimer(const char* label) = 0;
+        virtual void endTimer() = 0;
+    public: // GPU Command Query
+        virtual void beginQuery(GPUQuery *query) = 0;
+        virtual void endQuery(GPUQuery *query) = 0;
+        virtual void beginConditional(GPUQuery *query) = 0;
+        virtual void endConditional() = 0;
 
     public: // GPU Command State
         virtual void usePipeline(GPUPipeline *pipeline) = 0;
@@ -81,6 +149,7 @@ class GPUCommands {
         virtual void useBlockBinding(GPUBuffer *buffer, GPUBlockBinding bind, int index) = 0;
         virtual void useBlockBindingRange(GPUBuffer *buffer, GPUBlockBinding bind, int index, int offset, int size) = 0;
         virtual void useTexture(GPUTexture *texture, int index) = 0;
+        virtual void useTextureSampler(GPUTexture *texture, GPUUniform *sampler) = 0;
         virtual void useFrameBuffer(GPUFrameBuffer *framebuffer) = 0;
         virtual void useFrameBufferDraw(GPUFrameBuffer *framebuffer) = 0;
         virtual void useFrameBufferRead(GPUFrameBuffer *framebuffer) = 0;
@@ -94,11 +163,66 @@ class GPUCommands {
         virtual void drawArraysInstanced(GPUDrawPrimitive type, int offset, int count, int instance_count) = 0;
         virtual void drawElementsInstanced(GPUDrawPrimitive type, int offset, int count, GPUDrawElements element, int instance_count) = 0;
         virtual void drawElementsBaseVertexInstanced(GPUDrawPrimitive type, int offset, int count, int base, GPUDrawElements element, int instance_count) = 0;
+        virtual void drawArraysIndirect(GPUDrawPrimitive type, GPUBuffer *indirect, int offset) = 0;
+        virtual void drawElementsIndirect(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset) = 0;
+        virtual void multiDrawElementsIndirectCount(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset, GPUBuffer *count, int count_offset, int max_count, int stride) = 0;
         virtual void executeComputeSync(int x, int y, int z) = 0;
         virtual void executeCompute(int x, int y, int z) = 0;
+        virtual void executeComputeIndirect(GPUBuffer *indirect, int offset) = 0;
         virtual void memoryBarrier(GPUMemoryBarrier from, GPUMemoryBarrier to) = 0;
 };
 
+// -----------------------
+// GPU Context: Draw Queue
+// -----------------------
+
+enum class GPUDrawQueueMode : int {
+    QUEUE_SORTED,
+    QUEUE_STABLE
+};
+
+typedef struct {
+    GPUTexture* texture;
+    int index;
+} GPUDrawTexture;
+
+typedef struct {
+    GPUBuffer* buffer;
+    GPUBlockBinding bind;
+    int index, offset, size;
+} GPUDrawBinding;
+
+typedef struct {
+    GPUFrameBuffer* framebuffer;
+    GPUPipeline* pipeline;
+    GPUVertexArray* vertex_array;
+    GPUDrawTexture* textures;
+    GPUDrawBinding* bindings;
+    int textures_count;
+    int bindings_count;
+    // Draw Parameters
+    GPUDrawPrimitive primitive;
+    GPUDrawElements element;
+    bool indexed;
+    int offset, count;
+    int base, instance_count;
+} GPUDrawItem;
+
+typedef struct {
+    int draws;
+    int changes;
+    int saved;
+} GPUDrawQueueStats;
+
+class GPUDrawQueue {
+    public: // GPU Draw Queue
+        virtual void destroy() = 0;
+        virtual void clearQueue() = 0;
+        virtual void pushDraw(GPUDrawItem item) = 0;
+        virtual void dispatchQueue(GPUCommands* commands, GPUDrawQueueMode mode) = 0;
+        virtual GPUDrawQueueStats getStats() = 0;
+};
+
 GPUMemoryBarrier operator|(GPUMemoryBarrier a, GPUMemoryBarrier b);
 GPUMemoryBarrier operator&(GPUMemoryBarrier a, GPUMemoryBarrier b);
 GPUDrawClear operator|(GPUDrawClear a, GPUDrawClear b);
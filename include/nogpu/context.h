@@ -27,6 +27,7 @@ class GPUContext {
         virtual void destroy() = 0;
         virtual GPUBuffer* createBuffer() = 0;
         virtual GPUVertexArray* createVertexArray() = 0;
+        virtual GPUStreamBuffer* createStreamBuffer(int bytes, int frames) = 0;
         virtual GPUTextureBuffer* createTextureBuffer(GPUBuffer* buffer, GPUTexturePixelType type) = 0;
     public: // GPU Texture Objects: Standard
         virtual GPUTexture1D* createTexture1D(GPUTexturePixelType type) = 0;
@@ -48,6 +49,19 @@ class GPUContext {
         virtual GPUProgram* createProgram() = 0;
         virtual GPUPipeline* createPipeline() = 0;
         virtual GPUCommands* createCommands() = 0;
+        virtual GPUCommands* createCommandsDeferred() = 0;
+        virtual GPUCommands* createCommandsBundle() = 0;
+        virtual GPUDrawQueue* createDrawQueue() = 0;
+        virtual GPUFenceQueue* createFenceQueue() = 0;
+        virtual GPUQuery* createQuery(GPUQueryType type) = 0;
+    public: // GPU Rendering Submit
+        virtual void submit(GPUCommands** list, int count) = 0;
+    public: // GPU Rendering Timeline
+        virtual unsigned long long signal() = 0;
+        virtual void waitUntil(unsigned long long value) = 0;
+        virtual unsigned long long completedValue() = 0;
+    public: // GPU Rendering Timers
+        virtual GPUTimerTable getTimers() = 0;
     public: // GPU Rendering Surface
         virtual void surfaceSwap() = 0;
         virtual void surfaceResize(int w, int h) = 0;
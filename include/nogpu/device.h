@@ -19,6 +19,28 @@ typedef struct {
     GPUDebugLevel level;
 } GPUDebugReport;
 
+typedef struct {
+    unsigned int source;
+    unsigned int type;
+    unsigned int id;
+    unsigned int count;
+    unsigned int suppressed;
+} GPUDebugStats;
+
+typedef struct {
+    unsigned long long binds;
+    unsigned long long elided;
+    unsigned long long texture_hits;
+    unsigned long long texture_misses;
+    unsigned long long draws_recorded;
+    unsigned long long draws_issued;
+    unsigned long long barriers;
+    // Hashmap Heap Traffic
+    unsigned int hashmap_allocs;
+    unsigned int hashmap_reallocs;
+    unsigned int hashmap_frees;
+} GPUStateCounters;
+
 typedef void (*GPUDebugCallback)(
     void* userdata, GPUDebugReport report);
 
@@ -58,6 +80,10 @@ enum class GPUDriverFeature : int {
     DRIVER_FEATURE_RASTERIZE,
     DRIVER_FEATURE_COMPUTE,
     DRIVER_FEATURE_DEBUG,
+    DRIVER_FEATURE_DRAW_INDIRECT,
+    DRIVER_FEATURE_DRAW_INDIRECT_COUNT,
+    DRIVER_FEATURE_QUERY_STATISTICS,
+    DRIVER_FEATURE_BUFFER_STORAGE,
 
     // Texture Features
     DRIVER_TEXTURE_1D,
@@ -131,6 +157,7 @@ class GPUDriver {
         virtual GPUDevice* impl__createDevice(GPUDeviceOption device, int samples, bool rgba) = 0;
         virtual void impl__setVerticalSync(bool value) = 0;
         virtual bool impl__getVerticalSync() = 0;
+        virtual void impl__setDebugSynchronous(bool value) = 0;
         virtual bool impl__getDriverFeature(GPUDriverFeature feature) = 0;
         virtual GPUDriverOption impl__getDriverOption() = 0;
         virtual bool impl__shutdown() = 0;
@@ -139,6 +166,13 @@ class GPUDriver {
         static bool initialize(GPUDriverOption driver, GPUDriverMode mode);
         static GPUDevice* createDevice(GPUDeviceOption device, int samples, bool rgba);
         static void setDebugCallback(GPUDebugCallback cb, void* userdata);
+        static void setDebugAsync(bool value);
+        static void setDebugSynchronous(bool value);
+        static void setDebugFile(const char* filename);
+        static unsigned int getDebugDropped();
+        static void flushDebug();
+        static void setTracing(bool value);
+        static bool exportTracing(const char* filename);
         static void setVerticalSync(bool value);
         static bool getVerticalSync();
         static bool getDriverFeature(GPUDriverFeature feature);
@@ -154,6 +188,11 @@ class GPUDevice {
         virtual int checkSamples() = 0;
         virtual bool checkRGBA() = 0;
         virtual bool destroy() = 0;
+    public: // Debug Message Counters
+        virtual int getDebugStats(GPUDebugStats* stats, int capacity) = 0;
+        virtual void setDebugInterval(int ms) = 0;
+    public: // State Change Counters
+        virtual GPUStateCounters getStateCounters() = 0;
 
     // Context Creation: GLFW
     #if defined(NOGPU_GLFW)
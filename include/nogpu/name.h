@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#ifndef NOGPU_NAME_H
+#define NOGPU_NAME_H
+
+// ------------------------
+// GPU Objects: Hashed Name
+// ------------------------
+
+#define GPU_NAME_SEED 2166136261u
+#define GPU_NAME_PRIME 16777619u
+
+class GPUName {
+    static constexpr unsigned int hash(const char* name, unsigned int h) {
+        return (*name == '\0') ? h : hash(name + 1,
+            (h ^ static_cast<unsigned char>(*name)) * GPU_NAME_PRIME);
+    }
+
+    public: // Hashed Name Attributes
+        const char* name;
+        unsigned int key;
+
+    public: // Hashed Name Constructor
+        constexpr GPUName(const char* name) :
+            name(name), key(hash(name, GPU_NAME_SEED)) {}
+};
+
+#endif // NOGPU_NAME_H
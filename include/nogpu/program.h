@@ -2,6 +2,7 @@
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
 #ifndef NOGPU_PROGRAM_H
 #define NOGPU_PROGRAM_H
+#include "name.h"
 
 // ---------------------------
 // GPU Objects: Program Shader
@@ -128,7 +129,9 @@ class GPUProgram {
 
     public: // GPU Program Uniforms
         virtual GPUUniform* createUniform(const char* label, GPUUniformType type) = 0;
+        virtual GPUUniform* createUniform(GPUName label, GPUUniformType type) = 0;
         virtual GPUUniform* getUniform(const char* label) = 0;
+        virtual GPUUniform* getUniform(GPUName label) = 0;
         virtual bool removeUniform(const char* label) = 0;
 };
 
@@ -3,139 +3,398 @@
 #include "nogpu_map.h"
 #include <cstdlib>
 #include <cstring>
+#include <atomic>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
+// Hashmap Control Bytes
+#define HASHMAP_GROUP 16
+#define HASHMAP_EMPTY 0x80
+#define HASHMAP_PENDING 0xFE
+#define HASHMAP_CAPACITY 16
+
+// --------------------------
+// Hashmap Control: Group SIMD
+// --------------------------
+
+#if defined(__SSE2__)
+
+static inline unsigned int group_match(unsigned char* ctrl, unsigned char h2) {
+    __m128i group = _mm_loadu_si128((const __m128i*) ctrl);
+    __m128i check = _mm_cmpeq_epi8(group, _mm_set1_epi8((char) h2));
+    return (unsigned int) _mm_movemask_epi8(check);
+}
+
+static inline unsigned int group_free(unsigned char* ctrl) {
+    __m128i group = _mm_loadu_si128((const __m128i*) ctrl);
+    return (unsigned int) _mm_movemask_epi8(group);
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+static inline unsigned int group_mask(uint8x16_t check) {
+    static const unsigned char bits[16] = {
+        1, 2, 4, 8, 16, 32, 64, 128,
+        1, 2, 4, 8, 16, 32, 64, 128
+    };
+
+    // Pack Compared Lanes into a Bitmask
+    uint8x16_t mask = vandq_u8(check, vld1q_u8(bits));
+    unsigned int lo = vaddv_u8(vget_low_u8(mask));
+    unsigned int hi = vaddv_u8(vget_high_u8(mask));
+    return lo | (hi << 8);
+}
+
+static inline unsigned int group_match(unsigned char* ctrl, unsigned char h2) {
+    uint8x16_t group = vld1q_u8(ctrl);
+    return group_mask(vceqq_u8(group, vdupq_n_u8(h2)));
+}
+
+static inline unsigned int group_free(unsigned char* ctrl) {
+    uint8x16_t group = vld1q_u8(ctrl);
+    return group_mask(vcltzq_s8(vreinterpretq_s8_u8(group)));
+}
+
+#else
+
+static inline unsigned int group_match(unsigned char* ctrl, unsigned char h2) {
+    unsigned int mask = 0;
+    for (int i = 0; i < HASHMAP_GROUP; i++)
+        mask |= (unsigned int) (ctrl[i] == h2) << i;
+    // Return Matched Lanes
+    return mask;
+}
+
+static inline unsigned int group_free(unsigned char* ctrl) {
+    unsigned int mask = 0;
+    for (int i = 0; i < HASHMAP_GROUP; i++)
+        mask |= (unsigned int) (ctrl[i] >> 7) << i;
+    // Return Free Lanes
+    return mask;
+}
+
+#endif
+
+static inline unsigned int group_hash(unsigned int key) {
+    key ^= key >> 16;
+    key *= 0x85ebca6bu;
+    key ^= key >> 13;
+    key *= 0xc2b2ae35u;
+    key ^= key >> 16;
+    // Return Mixed Key
+    return key;
+}
+
+// ---------------------
+// Hashmap Heap Counters
+// ---------------------
+
+static std::atomic<unsigned int> g_counters_allocs(0);
+static std::atomic<unsigned int> g_counters_reallocs(0);
+static std::atomic<unsigned int> g_counters_frees(0);
+
+GPUHashmapCounters GPUHashmapOpaque::counters() {
+    GPUHashmapCounters result;
+    result.allocs = g_counters_allocs.load(std::memory_order_relaxed);
+    result.reallocs = g_counters_reallocs.load(std::memory_order_relaxed);
+    result.frees = g_counters_frees.load(std::memory_order_relaxed);
+    // Return Current Counters
+    return result;
+}
+
+void GPUHashmapOpaque::resetCounters() {
+    g_counters_allocs.store(0, std::memory_order_relaxed);
+    g_counters_reallocs.store(0, std::memory_order_relaxed);
+    g_counters_frees.store(0, std::memory_order_relaxed);
+}
 
 // -------------------
 // Hashmap Constructor
 // -------------------
 
-GPUHashmapOpaque::GPUHashmapOpaque(int size, void* fast) noexcept {
+GPUHashmapOpaque::GPUHashmapOpaque(int size, int stride, void* fast, int count) noexcept {
     m_buffer = (GPUHashmapItem*) fast;
+    m_ctrl = nullptr;
+    m_names = nullptr;
     m_item = size;
-    m_capacity = 1;
+    m_stride = stride;
+    m_capacity = count;
     m_len = 0;
 }
 
 GPUHashmapOpaque::~GPUHashmapOpaque() noexcept {
-    if (m_capacity > 1)
+    if (m_ctrl != nullptr) {
+        free(m_buffer);
+        g_counters_frees++;
+    }
+}
+
+void GPUHashmapOpaque::assign(const GPUHashmapOpaque& map, void* fast, int count) {
+    if (this == &map)
+        return;
+
+    // Reset to Inline Buffer
+    if (m_ctrl != nullptr) {
         free(m_buffer);
+        g_counters_frees++;
+    }
+
+    m_buffer = (GPUHashmapItem*) fast;
+    m_ctrl = nullptr;
+    m_names = map.m_names;
+    m_capacity = count;
+    m_len = 0;
+
+    // Copy Hashmap Items
+    GPUHashmapOpaque* src = const_cast<GPUHashmapOpaque*>(&map);
+    for (int idx = src->next(0); idx < src->last(); idx = src->next(idx + 1)) {
+        GPUHashmapItem* item = src->lookup(idx);
+        this->insert(item->key, item->name, item->data);
+    }
 }
 
 // ---------------------
 // Hashmap Data: Finding
 // ---------------------
 
-static unsigned int FNV1a(void* seed, const char* key) {
-    unsigned int hash = 2166136261u;
-    unsigned int *s = (unsigned int*) &seed;
-    hash ^= s[0];
-    hash *= 16777619;
-    hash ^= s[1];
-    hash *= 16777619;
-
-    // Hash Key
+static unsigned int FNV1a(const char* key) {
+    unsigned int hash = GPU_NAME_SEED;
+    // Hash Key, Same as GPUName
     while (*key) {
-        hash ^= (unsigned int) *key++;
-        hash *= 16777619;
+        hash ^= (unsigned char) *key++;
+        hash *= GPU_NAME_PRIME;
     }
 
     // Return Hashed String
     return hash;
 }
 
-unsigned int GPUHashmapOpaque::find(unsigned int key) {
-    unsigned char* buffer = (unsigned char*) m_buffer;
-    const unsigned int head = sizeof(GPUHashmapItem);
-    const unsigned int item = m_item;
-    int stride = head + item;
-
-    unsigned int idx = 0;
-    unsigned int end = m_len;
-    unsigned int mid;
-    // Find Upper Bound
-    while (idx < end) {
-        mid = idx + ((end - idx) >> 1);
-        GPUHashmapItem* item = (GPUHashmapItem*) (buffer + mid * stride);
-        // Check Item Upper Bound
-        if (item->key < key)
-            idx = mid + 1;
-        else end = mid;
-    }
-
-    // Return Found
+int GPUHashmapOpaque::find(unsigned int key) {
+    if (m_ctrl == nullptr) {
+        for (int idx = 0; idx < m_len; idx++)
+            if (this->lookup(idx)->key == key)
+                return idx;
+        // Not Found
+        return -1;
+    }
+
+    unsigned int hash = group_hash(key);
+    unsigned int mask = m_capacity - 1;
+    unsigned int pos = hash & mask;
+    unsigned char h2 = hash >> 25;
+    // Probe Control Groups
+    while (true) {
+        unsigned char* group = m_ctrl + pos;
+        unsigned int match = group_match(group, h2);
+        while (match != 0) {
+            unsigned int idx = (pos + __builtin_ctz(match)) & mask;
+            if (this->lookup(idx)->key == key)
+                return idx;
+            match &= match - 1;
+        }
+
+        // Stop at First Empty Slot
+        if (group_match(group, HASHMAP_EMPTY) != 0)
+            return -1;
+        pos = (pos + HASHMAP_GROUP) & mask;
+    }
+}
+
+int GPUHashmapOpaque::next(int idx) {
+    if (m_ctrl == nullptr)
+        return (idx < m_len) ? idx : m_len;
+
+    // Skip Empty Slots
+    while (idx < m_capacity && (m_ctrl[idx] & 0x80) != 0)
+        idx++;
     return idx;
 }
 
+int GPUHashmapOpaque::last() {
+    return (m_ctrl != nullptr) ? m_capacity : m_len;
+}
+
 // --------------------
 // Hashmap Data: Buffer
 // --------------------
 
 GPUHashmapOpaque::GPUHashmapItem* GPUHashmapOpaque::lookup(int idx) {
     unsigned char* buffer = (unsigned char*) m_buffer;
-    const unsigned int head = sizeof(GPUHashmapItem);
-    const unsigned int item = m_item;
-
     // Lookup Hashmap Item
-    idx *= head + item;
-    return (GPUHashmapItem*) (buffer + idx);
+    return (GPUHashmapItem*) (buffer + idx * m_stride);
 }
 
-void GPUHashmapOpaque::insert(int idx, unsigned int key, void* data) {
-    unsigned char* buffer = (unsigned char*) m_buffer;
-    const unsigned int head = sizeof(GPUHashmapItem);
-    const unsigned int item = m_item;
-    // Scale Index to Stride Bytes
-    int stride = head + item;
-    int len = m_len * stride;
-    idx *= stride;
-
-    // Shift Elements to Right
-    if (m_capacity > 1)
-        memmove(buffer + idx + stride, buffer + idx, len - idx);
-    // Put Element at Position
-    memcpy(buffer + idx, &key, sizeof(unsigned int));
-    memcpy(buffer + idx + head, data, item);
+static inline void control(unsigned char* ctrl, int capacity, int idx, unsigned char value) {
+    ctrl[idx] = value;
+    // Mirror Leading Bytes for Unaligned Groups
+    if (idx < HASHMAP_GROUP - 1)
+        ctrl[capacity + idx] = value;
+}
+
+void GPUHashmapOpaque::place(unsigned int key, unsigned int name, void* data) {
+    unsigned int hash = group_hash(key);
+    unsigned int mask = m_capacity - 1;
+    unsigned int pos = hash & mask;
+
+    // Find First Free Slot
+    unsigned int free;
+    while ((free = group_free(m_ctrl + pos)) == 0)
+        pos = (pos + HASHMAP_GROUP) & mask;
+    int idx = (pos + __builtin_ctz(free)) & mask;
+
+    // Put Element at Slot
+    GPUHashmapItem* item = this->lookup(idx);
+    control(m_ctrl, m_capacity, idx, hash >> 25);
+    item->key = key;
+    item->name = name;
+    memcpy(item->data, data, m_item);
+}
+
+void GPUHashmapOpaque::insert(unsigned int key, unsigned int name, void* data) {
+    if (m_ctrl == nullptr) {
+        if (m_len < m_capacity) {
+            GPUHashmapItem* item = this->lookup(m_len);
+            item->key = key;
+            item->name = name;
+            memcpy(item->data, data, m_item);
+            m_len++;
+            return;
+        }
+
+        this->expand();
+    } else if ((m_len + 1) * 8 > m_capacity * 7)
+        this->expand();
+
+    // Put Element at Hashed Slot
+    this->place(key, name, data);
     m_len++;
 }
 
-void GPUHashmapOpaque::expand(int idx, unsigned int key, void* data) {
-    const unsigned int head = sizeof(GPUHashmapItem);
-    const unsigned int item = m_item;
-    // Scale Index to Stride Bytes
-    int capacity = m_capacity * 2;
-    int stride = head + item;
-    int len = m_len * stride;
-    idx *= stride;
-
-    // Create Buffer With Twice Capacity
-    unsigned char* buffer0 = (unsigned char*) m_buffer;
-    unsigned char* buffer = (unsigned char*) malloc(stride * capacity);    
-    // Copy Buffer Data to New Buffer
-    memcpy(buffer, buffer0, idx);
-    memcpy(buffer + idx + stride, buffer0 + idx, len - idx);
-    memcpy(buffer + idx, &key, sizeof(unsigned int));
-    memcpy(buffer + idx + head, data, item);
-
-    // Change Current Buffer
-    if (capacity > 2)
-        free(buffer0);
+void GPUHashmapOpaque::expand() {
+    const int stride = m_stride;
+    // Promote Inline Buffer to Table
+    if (m_ctrl == nullptr) {
+        int capacity = HASHMAP_CAPACITY;
+        while ((m_len + 1) * 8 > capacity * 7)
+            capacity <<= 1;
+
+        int bytes = (capacity + 1) * stride + capacity + HASHMAP_GROUP;
+        unsigned char* buffer0 = (unsigned char*) m_buffer;
+        unsigned char* buffer = (unsigned char*) malloc(bytes);
+        unsigned char* ctrl = buffer + (capacity + 1) * stride;
+        g_counters_allocs++;
+        memset(ctrl, HASHMAP_EMPTY, capacity + HASHMAP_GROUP);
+
+        m_buffer = (GPUHashmapItem*) buffer;
+        m_ctrl = ctrl;
+        m_capacity = capacity;
+        // Place Inline Items to Table
+        for (int idx = 0; idx < m_len; idx++) {
+            GPUHashmapItem* item = (GPUHashmapItem*) (buffer0 + idx * stride);
+            this->place(item->key, item->name, item->data);
+        }
+
+        return;
+    }
+
+    // Grow Buffer With Twice Capacity
+    int capacity0 = m_capacity;
+    int capacity = capacity0 * 2;
+    int bytes = (capacity + 1) * stride + capacity + HASHMAP_GROUP;
+    unsigned char* buffer = (unsigned char*) realloc(m_buffer, bytes);
+    g_counters_reallocs++;
+    unsigned char* ctrl0 = buffer + (capacity0 + 1) * stride;
+    unsigned char* ctrl = buffer + (capacity + 1) * stride;
+    memmove(ctrl, ctrl0, capacity0);
+
+    // Mark Current Items as Pending
+    for (int idx = 0; idx < capacity0; idx++)
+        if (ctrl[idx] != HASHMAP_EMPTY)
+            ctrl[idx] = HASHMAP_PENDING;
+    memset(ctrl + capacity0, HASHMAP_EMPTY, capacity0 + HASHMAP_GROUP);
+    memcpy(ctrl + capacity, ctrl, HASHMAP_GROUP - 1);
+
+    // Rehash Items on Same Buffer
     m_buffer = (GPUHashmapItem*) buffer;
+    m_ctrl = ctrl;
     m_capacity = capacity;
-    m_len++;
+    this->rehash(capacity0);
+}
+
+void GPUHashmapOpaque::rehash(int capacity0) {
+    unsigned int mask = m_capacity - 1;
+    GPUHashmapItem* swap = this->lookup(m_capacity);
+
+    for (int idx = 0; idx < capacity0; idx++) {
+        while (m_ctrl[idx] == HASHMAP_PENDING) {
+            GPUHashmapItem* item = this->lookup(idx);
+            unsigned int hash = group_hash(item->key);
+            unsigned int pos = hash & mask;
+
+            // Find First Free or Pending Slot
+            unsigned int free;
+            while ((free = group_free(m_ctrl + pos)) == 0)
+                pos = (pos + HASHMAP_GROUP) & mask;
+            int target = (pos + __builtin_ctz(free)) & mask;
+
+            // Keep Item at Same Slot
+            if (target == idx) {
+                control(m_ctrl, m_capacity, idx, hash >> 25);
+                break;
+            }
+
+            // Move Item to Empty Slot
+            GPUHashmapItem* dst = this->lookup(target);
+            if (m_ctrl[target] == HASHMAP_EMPTY) {
+                memcpy(dst, item, m_stride);
+                control(m_ctrl, m_capacity, target, hash >> 25);
+                control(m_ctrl, m_capacity, idx, HASHMAP_EMPTY);
+                break;
+            }
+
+            // Swap Item with Pending Slot
+            memcpy(swap, dst, m_stride);
+            memcpy(dst, item, m_stride);
+            memcpy(item, swap, m_stride);
+            control(m_ctrl, m_capacity, target, hash >> 25);
+        }
+    }
 }
 
 void GPUHashmapOpaque::takeoff(int idx) {
-    unsigned char* buffer = (unsigned char*) m_buffer;
-    const unsigned int head = sizeof(GPUHashmapItem);
-    const unsigned int item = m_item;
-    // Scale Index to Stride Bytes
-    int stride = head + item;
-    int len = m_len * stride;
-    idx *= stride;
-
-    // Shift Elements to Right
-    memcpy(buffer + idx, buffer + idx + stride,
-        len - idx - stride);
+    if (m_ctrl == nullptr) {
+        // Replace Item with Last Item
+        if (idx != m_len - 1)
+            memcpy(this->lookup(idx), this->lookup(m_len - 1), m_stride);
+        m_len--;
+        return;
+    }
+
+    unsigned int mask = m_capacity - 1;
+    unsigned int hole = idx;
+    unsigned int pos = idx;
+    // Shift Back Displaced Items
+    while (true) {
+        pos = (pos + 1) & mask;
+        if (m_ctrl[pos] == HASHMAP_EMPTY)
+            break;
+
+        // Check if Hole is Reachable from Item Home
+        GPUHashmapItem* item = this->lookup(pos);
+        unsigned int home = group_hash(item->key) & mask;
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            memcpy(this->lookup(hole), item, m_stride);
+            control(m_ctrl, m_capacity, hole, m_ctrl[pos]);
+            hole = pos;
+        }
+    }
+
     // Remove Item
+    control(m_ctrl, m_capacity, hole, HASHMAP_EMPTY);
     m_len--;
 }
 
@@ -145,13 +404,10 @@ void GPUHashmapOpaque::takeoff(int idx) {
 
 bool GPUHashmapOpaque::add_key0(unsigned int key, void* data) {
     int idx = this->find(key);
-    bool check = idx >= m_len || this->lookup(idx)->key != key;
+    bool check = idx < 0;
     // Check and Add to Hashmap
-    if (check) {
-        if (m_len < m_capacity)
-            this->insert(idx, key, data);
-        else this->expand(idx, key, data);
-    }
+    if (check)
+        this->insert(key, 0, data);
 
     // Return Success
     return check;
@@ -159,14 +415,12 @@ bool GPUHashmapOpaque::add_key0(unsigned int key, void* data) {
 
 bool GPUHashmapOpaque::replace_key0(unsigned int key, void* data) {
     int idx = this->find(key);
-    bool check = idx >= m_len || this->lookup(idx)->key != key;
+    bool check = idx < 0;
 
     // Add or Replace to Hashmap
-    if (check) {
-        if (m_len < m_capacity)
-            this->insert(idx, key, data);
-        else this->expand(idx, key, data);
-    } else {
+    if (check)
+        this->insert(key, 0, data);
+    else {
         void* target = this->lookup(idx)->data;
         memcpy(target, data, m_item);
     }
@@ -178,7 +432,7 @@ bool GPUHashmapOpaque::replace_key0(unsigned int key, void* data) {
 bool GPUHashmapOpaque::remove_key0(unsigned int key) {
     int idx = this->find(key);
     // Check and Remove from Hashmap
-    bool check = idx < m_len && this->lookup(idx)->key == key;
+    bool check = idx >= 0;
     if (check) this->takeoff(idx);
 
     // Return Success
@@ -186,25 +440,15 @@ bool GPUHashmapOpaque::remove_key0(unsigned int key) {
 }
 
 bool GPUHashmapOpaque::check_key0(unsigned int key) {
-    int idx = this->find(key);
-    bool check = idx < m_len;
-    if (!check) return check;
-
-    // Check if Item is Found
-    GPUHashmapItem* item = this->lookup(idx);
-    return item->key == key;
+    return this->find(key) >= 0;
 }
 
 void* GPUHashmapOpaque::get_key0(unsigned int key) {
     int idx = this->find(key);
-    bool check = idx < m_len;
-
     void* data = nullptr;
-    if (!check) return data;
     // Check if Item is Found
-    GPUHashmapItem* item = this->lookup(idx);
-    if (item->key == key)
-        data = &item->data;
+    if (idx >= 0)
+        data = &this->lookup(idx)->data;
     // Return Found Item
     return data;
 }
@@ -213,27 +457,248 @@ void* GPUHashmapOpaque::get_key0(unsigned int key) {
 // Hashmap Manipulation: Name
 // --------------------------
 
-bool GPUHashmapOpaque::add_name0(const char* hash, void* data) {
-    unsigned int key = FNV1a(this, hash);
-    return this->add_key0(key, data);
+int GPUHashmapOpaque::find_name(GPUName name) {
+    int idx = this->find(name.key);
+    if (m_names == nullptr)
+        return idx;
+    // Unshared Keys were Verified when Interned
+    if (idx >= 0) {
+        unsigned int id = this->lookup(idx)->name;
+        if (!m_names->shared(id) && m_names->hash(id) == name.key)
+            return idx;
+    }
+
+    // Resolve Name Moved to Other Key
+    unsigned int id = m_names->find(name);
+    if (id == 0)
+        return -1;
+    return this->find(m_names->key(id));
+}
+
+bool GPUHashmapOpaque::add_name0(const char* name, void* data) {
+    return this->add_name0(GPUName(name), data);
+}
+
+bool GPUHashmapOpaque::replace_name0(const char* name, void* data) {
+    return this->replace_name0(GPUName(name), data);
+}
+
+bool GPUHashmapOpaque::remove_name0(const char* name) {
+    return this->remove_name0(GPUName(name));
+}
+
+bool GPUHashmapOpaque::check_name0(const char* name) {
+    return this->check_name0(GPUName(name));
+}
+
+void* GPUHashmapOpaque::get_name0(const char* name) {
+    return this->get_name0(GPUName(name));
 }
 
-bool GPUHashmapOpaque::replace_name0(const char* hash, void* data) {
-    unsigned int key = FNV1a(this, hash);
-    return this->replace_key0(key, data);
+// ---------------------------------
+// Hashmap Manipulation: Hashed Name
+// ---------------------------------
+
+bool GPUHashmapOpaque::add_name0(GPUName name, void* data) {
+    if (m_names == nullptr)
+        return this->add_key0(name.key, data);
+
+    // Key Item by Interned Name Key
+    unsigned int id = m_names->intern(name);
+    unsigned int key = m_names->key(id);
+    bool check = this->find(key) < 0;
+    if (check)
+        this->insert(key, id, data);
+
+    // Return Success
+    return check;
+}
+
+bool GPUHashmapOpaque::replace_name0(GPUName name, void* data) {
+    if (m_names == nullptr)
+        return this->replace_key0(name.key, data);
+
+    // Key Item by Interned Name Key
+    unsigned int id = m_names->intern(name);
+    unsigned int key = m_names->key(id);
+    int idx = this->find(key);
+    bool check = idx < 0;
+
+    // Add or Replace to Hashmap
+    if (check)
+        this->insert(key, id, data);
+    else {
+        void* target = this->lookup(idx)->data;
+        memcpy(target, data, m_item);
+    }
+
+    // Return Was Replaced
+    return !check;
+}
+
+bool GPUHashmapOpaque::remove_name0(GPUName name) {
+    int idx = this->find_name(name);
+    // Check and Remove from Hashmap
+    bool check = idx >= 0;
+    if (check) this->takeoff(idx);
+
+    // Return Success
+    return check;
+}
+
+bool GPUHashmapOpaque::check_name0(GPUName name) {
+    return this->find_name(name) >= 0;
+}
+
+void* GPUHashmapOpaque::get_name0(GPUName name) {
+    int idx = this->find_name(name);
+    void* data = nullptr;
+    // Check if Item is Found
+    if (idx >= 0)
+        data = &this->lookup(idx)->data;
+    // Return Found Item
+    return data;
+}
+
+// -----------------------
+// Name Table: Constructor
+// -----------------------
+
+#define GPU_NAME_PAGE 4096
+#define GPU_NAME_ENTRIES 64
+
+GPUNameTable::GPUNameTable() noexcept {
+    m_pages = nullptr;
+    m_entries = nullptr;
+    m_count = 0;
+    m_capacity = 0;
+}
+
+GPUNameTable::~GPUNameTable() noexcept {
+    GPUNamePage* page = m_pages;
+    while (page != nullptr) {
+        GPUNamePage* next = page->next;
+        free(page);
+        page = next;
+    }
+
+    // Dealloc Entries
+    free(m_entries);
+}
+
+// -------------------
+// Name Table: Storage
+// -------------------
+
+const char* GPUNameTable::store(const char* name) {
+    GPUNamePage* page = m_pages;
+    int bytes = (int) strlen(name) + 1;
+    // Allocate New Page When Full
+    if (page == nullptr || page->bytes + bytes > page->capacity) {
+        int capacity = GPU_NAME_PAGE;
+        if (bytes > capacity)
+            capacity = bytes;
+
+        page = (GPUNamePage*) malloc(sizeof(GPUNamePage) + capacity);
+        page->next = m_pages;
+        page->bytes = 0;
+        page->capacity = capacity;
+        m_pages = page;
+    }
+
+    // Copy Name to Current Page
+    char* data = page->data + page->bytes;
+    memcpy(data, name, bytes);
+    page->bytes += bytes;
+    return data;
+}
+
+static inline unsigned int nextKey(unsigned int key) {
+    // Deterministic Key Sequence for Colliding Names
+    return key * GPU_NAME_PRIME + 1;
+}
+
+unsigned int GPUNameTable::search(unsigned int hash, const char* name) {
+    unsigned int key = hash;
+    unsigned int* found;
+    // Verify Names along Key Sequence
+    while ((found = m_keys.get_key(key)) != nullptr) {
+        GPUNameEntry* entry = m_entries + (*found - 1);
+        if (entry->name == name || strcmp(entry->name, name) == 0)
+            return *found;
+        key = nextKey(key);
+    }
+
+    // Not Found
+    return 0;
+}
+
+unsigned int GPUNameTable::append(unsigned int hash, const char* name) {
+    if (m_count == m_capacity) {
+        int capacity = (m_capacity > 0) ?
+            m_capacity << 1 : GPU_NAME_ENTRIES;
+        m_entries = (GPUNameEntry*) realloc(m_entries,
+            sizeof(GPUNameEntry) * capacity);
+        m_capacity = capacity;
+    }
+
+    // Find Unclaimed Key, Passed Keys are Shared
+    unsigned int key = hash;
+    unsigned int* found;
+    while ((found = m_keys.get_key(key)) != nullptr) {
+        m_entries[*found - 1].shared = true;
+        key = nextKey(key);
+    }
+
+    GPUNameEntry* entry = m_entries + m_count;
+    entry->name = this->store(name);
+    entry->hash = hash;
+    entry->key = key;
+    entry->shared = false;
+
+    // Claim Key with New ID
+    unsigned int id = (unsigned int) ++m_count;
+    m_keys.add_key(key, id);
+    return id;
+}
+
+// ---------------------
+// Name Table: Interning
+// ---------------------
+
+unsigned int GPUNameTable::intern(const char* name) {
+    unsigned int hash = FNV1a(name);
+    unsigned int id = this->search(hash, name);
+    // Append Name if Not Found
+    if (id == 0)
+        id = this->append(hash, name);
+
+    // Return Stable ID
+    return id;
+}
+
+unsigned int GPUNameTable::intern(GPUName name) {
+    unsigned int id = this->find(name);
+    // Append Name if Not Found
+    if (id == 0)
+        id = this->append(name.key, name.name);
+
+    // Return Stable ID
+    return id;
 }
 
-bool GPUHashmapOpaque::remove_name0(const char* hash) {
-    unsigned int key = FNV1a(this, hash);
-    return this->remove_key0(key);
+unsigned int GPUNameTable::find(const char* name) {
+    return this->search(FNV1a(name), name);
 }
 
-bool GPUHashmapOpaque::check_name0(const char* hash) {
-    unsigned int key = FNV1a(this, hash);
-    return this->check_key0(key);
+unsigned int GPUNameTable::find(GPUName name) {
+    return this->search(name.key, name.name);
 }
 
-void* GPUHashmapOpaque::get_name0(const char* hash) {
-    unsigned int key = FNV1a(this, hash);
-    return this->get_key0(key);
+const char* GPUNameTable::name(unsigned int id) {
+    const char* name = nullptr;
+    if (id > 0 && id <= (unsigned int) m_count)
+        name = m_entries[id - 1].name;
+    // Return Interned Name
+    return name;
 }
@@ -2,6 +2,7 @@
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
 #include <opengl/private/driver.h>
 #include <nogpu_private.h>
+#include <nogpu_trace.h>
 #include <nogpu.h>
 
 // Global Driver Definition
@@ -39,6 +40,7 @@ bool GPUDriver::impl__checkDriver() {
 }
 
 bool GPUDriver::shutdown() {
+    GPUReport::flush();
     bool result = (m_driver) &&
         m_driver->impl__shutdown();
     // Remove Current Driver
@@ -62,6 +64,35 @@ void GPUDriver::setDebugCallback(GPUDebugCallback cb, void* userdata) {
     GPUReport::setCallback(cb, userdata);
 }
 
+void GPUDriver::setDebugAsync(bool value) {
+    GPUReport::setAsync(value);
+}
+
+void GPUDriver::setDebugSynchronous(bool value) {
+    if (impl__checkDriver())
+        m_driver->impl__setDebugSynchronous(value);
+}
+
+void GPUDriver::setDebugFile(const char* filename) {
+    GPUReport::setFile(filename);
+}
+
+unsigned int GPUDriver::getDebugDropped() {
+    return GPUReport::getDropped();
+}
+
+void GPUDriver::flushDebug() {
+    GPUReport::flush();
+}
+
+void GPUDriver::setTracing(bool value) {
+    GPUTrace::setEnabled(value);
+}
+
+bool GPUDriver::exportTracing(const char* filename) {
+    return GPUTrace::exportChrome(filename);
+}
+
 void GPUDriver::setVerticalSync(bool value) {
     if (impl__checkDriver())
         m_driver->impl__setVerticalSync(value);
@@ -2,27 +2,48 @@
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
 #ifndef NOGPU_MAP_H
 #define NOGPU_MAP_H
+#include <nogpu/name.h>
+
+class GPUNameTable;
+typedef struct {
+    unsigned int allocs;
+    unsigned int reallocs;
+    unsigned int frees;
+} GPUHashmapCounters;
 
 class GPUHashmapOpaque {
     typedef struct {
         unsigned int key;
-        unsigned int size;
+        unsigned int name;
         char data[0];
     } GPUHashmapItem;
 
     protected: // Hashmap Attributes
         GPUHashmapItem* m_buffer;
+        unsigned char* m_ctrl;
+        GPUNameTable* m_names;
         int m_capacity, m_len;
-        int m_item, m_pad;
+        int m_item, m_stride;
 
-        unsigned int find(unsigned int key);
+        int find(unsigned int key);
+        int next(int idx);
+        int last();
         GPUHashmapItem* lookup(int idx);
-        void insert(int idx, unsigned int key, void* data);
-        void expand(int idx, unsigned int key, void* data);
+        int find_name(GPUName name);
+        void place(unsigned int key, unsigned int name, void* data);
+        void insert(unsigned int key, unsigned int name, void* data);
+        void expand();
+        void rehash(int capacity0);
         void takeoff(int idx);
     protected: // Hashmap Constructor
-        GPUHashmapOpaque(int size, void* fast) noexcept;
+        GPUHashmapOpaque(int size, int stride, void* fast, int count) noexcept;
+        GPUHashmapOpaque(const GPUHashmapOpaque&) = delete;
+        GPUHashmapOpaque& operator=(const GPUHashmapOpaque&) = delete;
+        void assign(const GPUHashmapOpaque& map, void* fast, int count);
         ~GPUHashmapOpaque() noexcept;
+    public: // Hashmap Heap Counters
+        static GPUHashmapCounters counters();
+        static void resetCounters();
 
     protected: // Hashmap Manipulation: ID
         bool add_key0(unsigned int key, void* data);
@@ -36,39 +57,51 @@ class GPUHashmapOpaque {
         bool remove_name0(const char* name);
         bool check_name0(const char* name);
         void* get_name0(const char* name);
+    protected: // Hashmap Manipulation: Hashed Name
+        bool add_name0(GPUName name, void* data);
+        bool replace_name0(GPUName name, void* data);
+        bool remove_name0(GPUName name);
+        bool check_name0(GPUName name);
+        void* get_name0(GPUName name);
 };
 
 // -------------------
 // GPU Hasmap Template
 // -------------------
 
-template <typename T>
+template <typename T, int N = 1>
 class GPUHashmap : GPUHashmapOpaque {
     typedef struct {
         unsigned int key;
-        unsigned int pad;
+        unsigned int name;
         T data;
     } GPUHashmapEntry;
-    GPUHashmapEntry m_fast;
+    GPUHashmapEntry m_fast[N];
     // Hashmap Iterator
     class GPUHashmapIterator {
-        unsigned char* mi_data;
+        GPUHashmap* mi_map;
+        int mi_idx;
         public: // Iterator Methods
-            void operator++() { mi_data += sizeof(GPUHashmapEntry); }
-            bool operator!=(GPUHashmapIterator a) { return mi_data != a.mi_data; }
-            T operator*() { return ((GPUHashmapEntry*) mi_data)->data; }
+            void operator++() { mi_idx = mi_map->next(mi_idx + 1); }
+            bool operator!=(GPUHashmapIterator a) { return mi_idx != a.mi_idx; }
+            T operator*() { return ((GPUHashmapEntry*) mi_map->lookup(mi_idx))->data; }
         public: // Iterator Constructor
-            static GPUHashmapIterator create(unsigned char* data, int offset) {
-                const unsigned int size = sizeof(GPUHashmapEntry);
-                GPUHashmapIterator i; i.mi_data = data + (size * offset);
+            static GPUHashmapIterator create(GPUHashmap* map, int idx) {
+                GPUHashmapIterator i;
+                i.mi_map = map;
+                i.mi_idx = idx;
                 return i;
             }
     };
 
     public: // Hashmap Constructor
-        GPUHashmap() noexcept : GPUHashmapOpaque(sizeof(T), &m_fast) {}
-        GPUHashmapIterator begin() { return GPUHashmapIterator::create((unsigned char*) m_buffer, 0); }
-        GPUHashmapIterator end() { return GPUHashmapIterator::create((unsigned char*) m_buffer, m_len); }
+        GPUHashmap() noexcept : GPUHashmapOpaque(sizeof(T), sizeof(GPUHashmapEntry), m_fast, N) {}
+        GPUHashmap(GPUNameTable* names) noexcept : GPUHashmapOpaque(sizeof(T), sizeof(GPUHashmapEntry), m_fast, N) { m_names = names; }
+        GPUHashmap(const GPUHashmap& map) : GPUHashmapOpaque(sizeof(T), sizeof(GPUHashmapEntry), m_fast, N) { assign(map, m_fast, N); }
+        GPUHashmap& operator=(const GPUHashmap& map) { assign(map, m_fast, N); return *this; }
+        GPUHashmapIterator begin() { return GPUHashmapIterator::create(this, next(0)); }
+        GPUHashmapIterator end() { return GPUHashmapIterator::create(this, last()); }
+        int count() { return m_len; }
     public: // Hashmap Manipulation: ID
         bool add_key(unsigned int key, T data) { return add_key0(key, &data); }
         bool replace_key(unsigned int key, T data) { return replace_key0(key, &data); }
@@ -81,6 +114,57 @@ class GPUHashmap : GPUHashmapOpaque {
         bool remove_name(const char* name) { return remove_name0(name); }
         bool check_name(const char* name) { return check_name0(name); }
         T* get_name(const char* name) { return (T*) get_name0(name); }
+    public: // Hashmap Manipulation: Hashed Name
+        bool add_name(GPUName name, T data) { return add_name0(name, &data); }
+        bool replace_name(GPUName name, T data) { return replace_name0(name, &data); }
+        bool remove_name(GPUName name) { return remove_name0(name); }
+        bool check_name(GPUName name) { return check_name0(name); }
+        T* get_name(GPUName name) { return (T*) get_name0(name); }
+};
+
+// -----------------------
+// GPU Hashmap: Name Table
+// -----------------------
+
+class GPUNameTable {
+    typedef struct GPUNamePage {
+        struct GPUNamePage* next;
+        int bytes, capacity;
+        char data[0];
+    } GPUNamePage;
+
+    typedef struct {
+        const char* name;
+        unsigned int hash;
+        unsigned int key;
+        bool shared;
+    } GPUNameEntry;
+
+    GPUNamePage* m_pages;
+    GPUNameEntry* m_entries;
+    GPUHashmap<unsigned int> m_keys;
+    int m_count, m_capacity;
+
+    const char* store(const char* name);
+    unsigned int search(unsigned int hash, const char* name);
+    unsigned int append(unsigned int hash, const char* name);
+
+    public: // Name Table Constructor
+        GPUNameTable() noexcept;
+        GPUNameTable(const GPUNameTable&) = delete;
+        GPUNameTable& operator=(const GPUNameTable&) = delete;
+        ~GPUNameTable() noexcept;
+    public: // Name Table Interning
+        unsigned int intern(const char* name);
+        unsigned int intern(GPUName name);
+        unsigned int find(const char* name);
+        unsigned int find(GPUName name);
+        const char* name(unsigned int id);
+        int count() { return m_count; }
+    public: // Name Table Keys
+        unsigned int key(unsigned int id) { return m_entries[id - 1].key; }
+        unsigned int hash(unsigned int id) { return m_entries[id - 1].hash; }
+        bool shared(unsigned int id) { return m_entries[id - 1].shared; }
 };
 
 #endif // NOGPU_MAP_H
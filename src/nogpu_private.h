@@ -3,6 +3,8 @@
 #ifndef NOGPU_PRIVATE_H
 #define NOGPU_PRIVATE_H
 #include <nogpu/device.h>
+#include <cstdio>
+#include <cstdarg>
 
 class GPUContextCache {
     public: // Context Cache
@@ -40,6 +42,7 @@ class GPUReport {
     static GPUReport m_report;
     GPUDebugCallback m_callback;
     GPUDriverMode m_mode;
+    FILE* m_file;
     void* m_userdata;
     void* m_object;
 
@@ -49,6 +52,14 @@ class GPUReport {
         static void setMode(GPUDriverMode mode);
         static void setObject(void* object);
         static bool getEnabled();
+    public: // Reporting Asynchronous
+        static void dispatchMessage(GPUDebugLevel level, void* object, const char* message, int size);
+        static bool pushMessage(GPUDebugLevel level, void* object, const char* message, int size);
+        static bool pushFormat(GPUDebugLevel level, const char* format, va_list args);
+        static void setAsync(bool value);
+        static void setFile(const char* filename);
+        static unsigned int getDropped();
+        static void flush();
 
     #if defined(__clang__) || defined(__GNUC__)
         public:
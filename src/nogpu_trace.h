@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#ifndef NOGPU_TRACE_H
+#define NOGPU_TRACE_H
+#include <atomic>
+
+#if defined(__clang__) || defined(__GNUC__)
+    #define __nogpu_function() __builtin_FUNCTION()
+#else
+    #define __nogpu_function() "nogpu"
+#endif
+
+class GPUTrace {
+    friend class GPUTraceScope;
+    static std::atomic<bool> m_enabled;
+    static void record(const char* name, void* object, unsigned long long begin);
+
+    public: // Tracing Properties
+        static void setEnabled(bool value);
+        static bool getEnabled();
+        static bool exportChrome(const char* filename);
+        static unsigned long long clock();
+};
+
+// ------------------
+// GPU Tracing: Scope
+// ------------------
+
+class GPUTraceScope {
+    const char* m_name;
+    void* m_object;
+    unsigned long long m_begin;
+
+    public: // Scope Constructor
+        GPUTraceScope(void* object, const char* name) noexcept : m_name(nullptr) {
+            if (GPUTrace::m_enabled.load(std::memory_order_relaxed)) {
+                m_begin = GPUTrace::clock();
+                m_object = object;
+                m_name = name;
+            }
+        }
+
+        GPUTraceScope(GPUTraceScope&& scope) noexcept :
+            m_name(scope.m_name), m_object(scope.m_object), m_begin(scope.m_begin) {
+            scope.m_name = nullptr;
+        }
+
+        ~GPUTraceScope() noexcept {
+            if (m_name != nullptr)
+                GPUTrace::record(m_name, m_object, m_begin);
+        }
+
+        GPUTraceScope(const GPUTraceScope&) = delete;
+        GPUTraceScope& operator=(const GPUTraceScope&) = delete;
+};
+
+#endif // NOGPU_TRACE_H
@@ -58,19 +58,30 @@ static GLenum toValue(GPUBufferMapping flags) {
 // ------------------------------
 
 GLBuffer::GLBuffer(GLContext* ctx) {
-    ctx->makeCurrent(this);
+    GPUTraceScope trace = ctx->makeCurrent(this);
     m_ctx = ctx;
 
     // Create OpenGL Buffer
     glGenBuffers(1, &m_vbo);
     m_mapping = nullptr;
+    m_hazard_tick = 0;
+    m_stream = false;
     m_bytes = 0;
 }
 
 void GLBuffer::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_stream) {
+        GPUReport::error("buffer is owned by a stream buffer");
+        return;
+    }
+
     if (m_mapping) unmap();
     glDeleteBuffers(1, &m_vbo);
+    m_ctx->manipulateState()->clobberCommandsEffect(
+        GLCommandsEffect::CMD_EFFECT_BLOCK_BINDING);
+    m_ctx->manipulateState()->forgetIndirectBuffer(this);
+    m_ctx->manipulateState()->invalidateBundles(this);
 
     // Dealloc Object
     delete this;
@@ -81,7 +92,12 @@ void GLBuffer::destroy() {
 // ------------------------
 
 void GLBuffer::orphan(int bytes, GPUBufferUsage usage) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_mapping) {
+        GPUReport::error("buffer is mapped");
+        return;
+    }
+
     glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
     glBufferData(GL_COPY_WRITE_BUFFER, bytes, NULL, toValue(usage));
     // Set Buffer Bytes
@@ -89,7 +105,12 @@ void GLBuffer::orphan(int bytes, GPUBufferUsage usage) {
 };
 
 void GLBuffer::upload(void *data, int bytes, GPUBufferUsage usage) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_mapping) {
+        GPUReport::error("buffer is mapped");
+        return;
+    }
+
     glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
     glBufferData(GL_COPY_WRITE_BUFFER, bytes, data, toValue(usage));
     // Set Buffer Bytes
@@ -97,23 +118,32 @@ void GLBuffer::upload(void *data, int bytes, GPUBufferUsage usage) {
 };
 
 void GLBuffer::update(void *data, int bytes, int offset) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_stream) {
+        GPUReport::error("stream buffer storage is immutable");
+        return;
+    }
+
+    m_ctx->manipulateState()->hazardSync(this, GL_BUFFER_UPDATE_BARRIER_BIT);
     // Update Buffer Data
     glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
     glBufferSubData(GL_COPY_WRITE_BUFFER, offset, bytes, data);
 };
 
 void GLBuffer::download(void *data, int bytes, int offset) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    m_ctx->manipulateState()->hazardSync(this, GL_BUFFER_UPDATE_BARRIER_BIT);
     // Download Buffer Data
     glBindBuffer(GL_COPY_READ_BUFFER, m_vbo);
     glGetBufferSubData(GL_COPY_READ_BUFFER, offset, bytes, data);
 };
 
 void GLBuffer::copy(GPUBuffer *dest, int bytes, int offset_read, int offset_write) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Copy Buffer Data from Other Buffer
     GLBuffer* dst = static_cast<GLBuffer*>(dest);
+    m_ctx->manipulateState()->hazardRead(dst, GL_BUFFER_UPDATE_BARRIER_BIT);
+    m_ctx->manipulateState()->hazardSync(this, GL_BUFFER_UPDATE_BARRIER_BIT);
     glBindBuffer(GL_COPY_WRITE_BUFFER, dst->m_vbo);
     glBindBuffer(GL_COPY_READ_BUFFER, this->m_vbo);
     glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
@@ -121,13 +151,14 @@ void GLBuffer::copy(GPUBuffer *dest, int bytes, int offset_read, int offset_writ
 };
 
 void GLBuffer::clear(int offset, int bytes) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_mapping) {
         GPUReport::error("buffer is mapped");
         return;
     }
 
     // Use Optimized glClearBufferSubData is available
+    m_ctx->manipulateState()->hazardSync(this, GL_BUFFER_UPDATE_BARRIER_BIT);
     glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
     if (GLAD_GL_ARB_clear_buffer_object) {
         glClearBufferSubData(GL_COPY_WRITE_BUFFER, GL_R8,
@@ -147,18 +178,19 @@ void GLBuffer::clear(int offset, int bytes) {
 // --------------------------
 
 GPUFence* GLBuffer::syncFence() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_ctx->syncFence();
 }
 
 void* GLBuffer::map(int bytes, int offset, GPUBufferMapping flags) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_mapping) {
         GPUReport::error("buffer is already mapped");
         return nullptr;
     }
 
     GLenum flags0 = toValue(flags);
+    m_ctx->manipulateState()->hazardSync(this, GL_BUFFER_UPDATE_BARRIER_BIT);
     glBindBuffer(GL_COPY_WRITE_BUFFER, m_vbo);
     void* map = glMapBufferRange(GL_COPY_WRITE_BUFFER, offset, bytes, flags0);
 
@@ -168,10 +200,13 @@ void* GLBuffer::map(int bytes, int offset, GPUBufferMapping flags) {
 };
 
 void GLBuffer::unmap() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (!m_mapping) {
         GPUReport::warning("buffer is not mapped");
         return;
+    } else if (m_stream) {
+        GPUReport::error("stream buffer mapping is persistent");
+        return;
     }
 
     // Remove Buffer Mapping
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/buffer.h"
+#include "private/commands.h"
+#include "private/context.h"
+#include "private/glad.h"
+#include <cstdlib>
+#include <climits>
+
+GLStreamBuffer::GLStreamBuffer(GLContext* ctx, int bytes, int frames) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    // Keep Region Offsets Aligned for Block Bindings
+    m_bytes = (bytes + 255) & ~255;
+    m_frames = frames;
+    m_current = 0;
+    m_cursor = 0;
+    m_ctx = ctx;
+
+    // Allocate Immutable Storage Mapped Once
+    m_buffer = new GLBuffer(ctx);
+    m_buffer->m_bytes = m_bytes * frames;
+    m_buffer->m_stream = true;
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer->m_vbo);
+    glBufferStorage(GL_COPY_WRITE_BUFFER, m_buffer->m_bytes, nullptr, flags);
+    m_buffer->m_mapping = glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, m_buffer->m_bytes, flags);
+    m_mapping = (unsigned char*) m_buffer->m_mapping;
+    m_fences = (GLFence**) calloc(frames, sizeof(GLFence*));
+
+    // Register Stream for Surface Swap Advance
+    m_prev = nullptr;
+    m_next = ctx->m_stream_buffers;
+    if (m_next != nullptr)
+        m_next->m_prev = this;
+    ctx->m_stream_buffers = this;
+}
+
+void GLStreamBuffer::destroy() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    for (int i = 0; i < m_frames; i++)
+        if (m_fences[i] != nullptr)
+            m_fences[i]->destroy();
+
+    // Unregister Stream from Context
+    if (m_prev != nullptr)
+        m_prev->m_next = m_next;
+    else m_ctx->m_stream_buffers = m_next;
+    if (m_next != nullptr)
+        m_next->m_prev = m_prev;
+
+    // Dealloc Object
+    m_buffer->m_stream = false;
+    m_buffer->destroy();
+    free(m_fences);
+    delete this;
+}
+
+GPUStreamBuffer* GLContext::createStreamBuffer(int bytes, int frames) {
+    GPUTraceScope trace = makeCurrent(this);
+    if (!GLAD_GL_ARB_buffer_storage) {
+        GPUReport::error("persistent buffer storage is not supported");
+        return nullptr;
+    } else if (bytes <= 0 || frames <= 0) {
+        GPUReport::error("invalid stream buffer size");
+        return nullptr;
+    }
+
+    // Check Aligned Regions Fit Buffer Size
+    long long region = ((long long) bytes + 255) & ~255ll;
+    if (region * frames > INT_MAX) {
+        GPUReport::error("stream buffer size is too large");
+        return nullptr;
+    }
+
+    // Create Stream Buffer Object
+    return new GLStreamBuffer(this, bytes, frames);
+}
+
+// ---------------------------------
+// OpenGL GPU Stream Buffer: Regions
+// ---------------------------------
+
+GPUStreamAllocation GLStreamBuffer::allocate(int bytes, int alignment) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    GPUStreamAllocation result = {};
+    if (alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+        GPUReport::error("stream alignment must be a power of two");
+        return result;
+    }
+
+    // Bump Cursor Inside Current Region
+    int offset = (m_cursor + alignment - 1) & ~(alignment - 1);
+    if (bytes <= 0 || offset + bytes > m_bytes) {
+        GPUReport::error("stream buffer region is full");
+        return result;
+    }
+
+    m_cursor = offset + bytes;
+    offset += m_current * m_bytes;
+    // Coherent Mapping Needs no Flush
+    result.data = m_mapping + offset;
+    result.buffer = m_buffer;
+    result.offset = offset;
+    return result;
+}
+
+void GLStreamBuffer::advanceRegion() {
+    GLFence* fence = m_ctx->acquireFence(
+        glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    m_fences[m_current] = fence;
+    m_current = (m_current + 1) % m_frames;
+    m_cursor = 0;
+
+    // Wait GPU is Done with Next Region
+    fence = m_fences[m_current];
+    if (fence != nullptr) {
+        fence->waitCPU();
+        fence->destroy();
+        m_fences[m_current] = nullptr;
+    }
+}
+
+void GLStreamBuffer::advance() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    this->advanceRegion();
+}
+
+GPUBuffer* GLStreamBuffer::getBuffer() {
+    return m_buffer;
+}
+
+void GLContext::advanceStreamBuffers() {
+    GLStreamBuffer* stream = m_stream_buffers;
+    while (stream != nullptr) {
+        stream->advanceRegion();
+        stream = stream->m_next;
+    }
+}
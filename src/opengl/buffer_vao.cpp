@@ -38,7 +38,7 @@ static GLenum toValue(GPUAttributeType type) {
 // -----------------------------
 
 GLVertexArray::GLVertexArray(GLContext* ctx) {
-    ctx->makeCurrent(this);
+    GPUTraceScope trace = ctx->makeCurrent(this);
     m_ctx = ctx;
 
     // Generate Vertex Array
@@ -48,8 +48,10 @@ GLVertexArray::GLVertexArray(GLContext* ctx) {
 }
 
 void GLVertexArray::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glDeleteVertexArrays(1, &m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
+    m_ctx->manipulateState()->invalidateBundles(this);
 }
 
 // -------------------------
@@ -57,10 +59,11 @@ void GLVertexArray::destroy() {
 // -------------------------
 
 void GLVertexArray::useArrayBuffer(GPUBuffer* buffer) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
 
     if (buffer) {
         glBindVertexArray(m_vao);
+        m_ctx->manipulateState()->clobberVertexArray();
         GLBuffer* buf = static_cast<GLBuffer*>(buffer);
         glBindBuffer(GL_ARRAY_BUFFER, buf->m_vbo);
     } else glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -70,10 +73,11 @@ void GLVertexArray::useArrayBuffer(GPUBuffer* buffer) {
 };
 
 void GLVertexArray::useElementsBuffer(GPUBuffer* buffer) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
 
     if (buffer) {
         glBindVertexArray(m_vao);
+        m_ctx->manipulateState()->clobberVertexArray();
         GLBuffer* buf = static_cast<GLBuffer*>(buffer);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->m_vbo);
     } else glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -87,13 +91,14 @@ void GLVertexArray::useElementsBuffer(GPUBuffer* buffer) {
 // -----------------------------------
 
 void GLVertexArray::defineAttribute(int index, GPUAttributeSize size, GPUAttributeType type, int stride, int offset) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (!m_array_buffer) {
         GPUReport::error("an array buffer is not used to define attribute #%d", index);
         return;
     }
 
     glBindVertexArray(m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
     GLBuffer* buf = static_cast<GLBuffer*>(m_array_buffer);
     glBindBuffer(GL_ARRAY_BUFFER, buf->m_vbo);
     glVertexAttribPointer(index, toValue(size), toValue(type),
@@ -103,7 +108,7 @@ void GLVertexArray::defineAttribute(int index, GPUAttributeSize size, GPUAttribu
 };
 
 void GLVertexArray::defineNormalized(int index, GPUAttributeSize size, GPUAttributeType type, int stride, int offset) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (!m_array_buffer) {
         GPUReport::error("an array buffer is not used to define normalized attribute #%d", index);
         return;
@@ -113,6 +118,7 @@ void GLVertexArray::defineNormalized(int index, GPUAttributeSize size, GPUAttrib
     }
 
     glBindVertexArray(m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
     GLBuffer* buf = static_cast<GLBuffer*>(m_array_buffer);
     glBindBuffer(GL_ARRAY_BUFFER, buf->m_vbo);
     glVertexAttribPointer(index, toValue(size), toValue(type),
@@ -122,9 +128,10 @@ void GLVertexArray::defineNormalized(int index, GPUAttributeSize size, GPUAttrib
 };
 
 void GLVertexArray::defineInstanceDivisor(int index, int divisor) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Define Instance Divisor
     glBindVertexArray(m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
     glVertexAttribDivisor(index, divisor);
 }
 
@@ -133,15 +140,17 @@ void GLVertexArray::defineInstanceDivisor(int index, int divisor) {
 // -----------------------------------
 
 void GLVertexArray::disableAttribute(int index) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Disable Vertex Attribute
     glBindVertexArray(m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
     glDisableVertexAttribArray(index);
 };
 
 void GLVertexArray::enableAttribute(int index) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Enable Vertex Attribute
     glBindVertexArray(m_vao);
+    m_ctx->manipulateState()->clobberVertexArray();
     glEnableVertexAttribArray(index);
 };
@@ -1,4 +1,468 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
 #include "private/commands.h"
-#include "private/context.h"
\ No newline at end of file
+#include "private/context.h"
+#include "private/pipeline.h"
+#include "private/framebuffer.h"
+#include "private/texture.h"
+#include "private/program.h"
+#include "private/glad.h"
+#include <cstdlib>
+#include <cstring>
+
+GLCommands::GLCommands(GLContext* ctx, GLCommandsMode mode) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
+    m_ctx_state = &ctx->m_device->m_state;
+    m_ctx = ctx;
+    // Commands Linear Arena
+    m_arena = nullptr;
+    m_arena_bytes = 0;
+    m_arena_capacity = 0;
+    m_recording = false;
+    m_mode = mode;
+    m_state_stale = false;
+    // Commands Bundle Objects
+    m_bundle_objects = nullptr;
+    m_bundle_objects_count = 0;
+    m_bundle_objects_capacity = 0;
+    m_bundle_next = nullptr;
+    m_bundle_linked = false;
+    m_bundle_valid = false;
+    // Commands Bundle Baking
+    m_bake = nullptr;
+    m_bake_capacity = 0;
+    // Commands Multi-Draw Arrays
+    m_multi_first = nullptr;
+    m_multi_count = nullptr;
+    m_multi_base = nullptr;
+    m_multi_indices = nullptr;
+    m_multi_capacity = 0;
+}
+
+void GLCommands::destroy() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_ctx_state->m_commands_current == this)
+        m_ctx_state->m_commands_current = nullptr;
+    if (m_ctx_state->m_commands_cached == this)
+        m_ctx_state->m_commands_cached = nullptr;
+    if (m_bundle_linked)
+        m_ctx_state->unlinkBundle(this);
+
+    // Destroy Object
+    this->rewindFences();
+    free(m_bundle_objects);
+    free(m_bake);
+    free(m_multi_indices);
+    free(m_arena);
+    delete this;
+}
+
+bool GLCommands::prepareEffects() {
+    if (m_ctx_state->m_commands_current != this) {
+        GPUReport::error("commands are not being recorded");
+        return false;
+    }
+
+    // Resolve Pending Effects
+    return m_ctx_state->resolveEffects();
+}
+
+bool GLCommands::prepareShaders(bool vertex) {
+    if (!this->prepareEffects())
+        return false;
+
+    // Insert Barriers for Shader Write Hazards
+    m_ctx_state->resolveHazards(vertex);
+    return true;
+}
+
+// --------------------
+// GPU Commands: Record
+// --------------------
+
+void GLCommands::beginCommands() {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (m_recording.load(std::memory_order_relaxed)) {
+        GPUReport::error("commands are already being recorded");
+        return;
+    }
+
+    // Reset Arena but Keep Allocation
+    this->rewindFences();
+    m_arena_bytes = 0;
+    m_recording.store(true, std::memory_order_relaxed);
+}
+
+void GLCommands::endCommands() {
+    if (m_mode != GLCommandsMode::COMMANDS_IMMEDIATE) {
+        GPUTraceScope trace = m_ctx->makeRecord(this);
+        if (!m_recording.load(std::memory_order_relaxed)) {
+            GPUReport::error("commands are not being recorded");
+            return;
+        }
+
+        // Validate, Bake and Track Bundle Once
+        if (m_mode == GLCommandsMode::COMMANDS_BUNDLE) {
+            std::lock_guard<std::mutex> lock(GLState::m_bundles_mutex);
+            this->bakeBundle();
+            m_ctx_state->linkBundle(this);
+        }
+        // Publish Record for Submit Thread
+        m_recording.store(false, std::memory_order_release);
+        return;
+    }
+
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (!m_recording.load(std::memory_order_relaxed)) {
+        GPUReport::error("commands are not being recorded");
+        return;
+    }
+
+    // Replay Recorded Commands
+    m_recording.store(false, std::memory_order_relaxed);
+    this->replayCommands();
+    // Drain Asynchronous Debug Messages
+    m_ctx->m_device->m_debug.drain();
+}
+
+// ------------------------
+// GPU Commands: Syncronize
+// ------------------------
+
+void GLCommands::syncFlush() {
+    if (m_recording.load(std::memory_order_relaxed)) {
+        GPUTraceScope trace = m_ctx->makeRecord(this);
+        this->recordCommand(GLCommandType::CMD_SYNC_FLUSH, nullptr, 0);
+        return;
+    }
+
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    glFlush();
+}
+
+void GLCommands::syncFinish() {
+    if (m_recording.load(std::memory_order_relaxed)) {
+        GPUTraceScope trace = m_ctx->makeRecord(this);
+        this->recordCommand(GLCommandType::CMD_SYNC_FINISH, nullptr, 0);
+        return;
+    }
+
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    glFinish();
+}
+
+// -----------------------
+// GPU Commands: State Use
+// -----------------------
+
+void GLCommands::usePipeline(GPUPipeline *pipeline) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandObject use;
+    use.pipeline = static_cast<GLPipeline*>(pipeline);
+    this->recordCommand(GLCommandType::CMD_USE_PIPELINE, &use, sizeof(use));
+}
+
+void GLCommands::useVertexArray(GPUVertexArray *vertex_array) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandObject use;
+    use.vertex_array = static_cast<GLVertexArray*>(vertex_array);
+    this->recordCommand(GLCommandType::CMD_USE_VERTEX_ARRAY, &use, sizeof(use));
+}
+
+void GLCommands::useBlockBinding(GPUBuffer *buffer, GPUBlockBinding bind, int index) {
+    this->useBlockBindingRange(buffer, bind, index, 0, 0);
+}
+
+void GLCommands::useBlockBindingRange(GPUBuffer *buffer, GPUBlockBinding bind, int index, int offset, int size) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (index < 0 || index > 0xFFFF) {
+        GPUReport::error("invalid block binding index: %d", index);
+        return;
+    }
+
+    // Bindings are Compared with Padding
+    GLBlockBinding binding;
+    memset(&binding, 0, sizeof(binding));
+    binding.buffer = static_cast<GLBuffer*>(buffer);
+    binding.target = toValue(bind);
+    binding.index = index;
+    binding.offset = offset;
+    binding.size = size;
+    // Storage Blocks May be Written by Shaders
+    binding.writable = bind == GPUBlockBinding::BLOCK_SHADER_STORAGE ||
+        bind == GPUBlockBinding::BLOCK_ATOMIC_COUNTER;
+    // Record Block Binding
+    this->recordCommand(GLCommandType::CMD_USE_BLOCK_BINDING, &binding, sizeof(binding));
+}
+
+void GLCommands::useTexture(GPUTexture *texture, int index) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    unsigned int units = m_ctx_state->m_stole_texture - GL_TEXTURE0;
+    if (index < 0 || index >= (int) units) {
+        GPUReport::error("invalid texture unit index: %d", index);
+        return;
+    }
+
+    // Record Texture Unit, Null Removes
+    GLTextureActive active;
+    active.texture = dynamic_cast<GLTexture*>(texture);
+    active.unit = index;
+    this->recordCommand(GLCommandType::CMD_USE_TEXTURE, &active, sizeof(active));
+}
+
+void GLCommands::useTextureSampler(GPUTexture *texture, GPUUniform *sampler) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLUniform* uniform = static_cast<GLUniform*>(sampler);
+    if (uniform == nullptr || uniform->m_type != GPUUniformType::UNIFORM_TEXTURE_SAMPLER) {
+        GPUReport::error("uniform is not UNIFORM_TEXTURE_SAMPLER");
+        return;
+    }
+
+    // Record Texture Sampler, Null Removes
+    GLCommandSampler use;
+    use.key = (uniform->m_program->m_program << 16) | (uniform->m_uniform & 0xFFFF);
+    use.binding.texture = dynamic_cast<GLTexture*>(texture);
+    use.binding.sampler = uniform;
+    this->recordCommand(GLCommandType::CMD_USE_TEXTURE_SAMPLER, &use, sizeof(use));
+}
+
+void GLCommands::useFrameBuffer(GPUFrameBuffer *framebuffer) {
+    this->useFrameBufferDraw(framebuffer);
+    this->useFrameBufferRead(framebuffer);
+}
+
+void GLCommands::useFrameBufferDraw(GPUFrameBuffer *framebuffer) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandObject use;
+    use.framebuffer = static_cast<GLFrameBuffer*>(framebuffer);
+    this->recordCommand(GLCommandType::CMD_USE_FRAMEBUFFER_DRAW, &use, sizeof(use));
+}
+
+void GLCommands::useFrameBufferRead(GPUFrameBuffer *framebuffer) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandObject use;
+    use.framebuffer = static_cast<GLFrameBuffer*>(framebuffer);
+    this->recordCommand(GLCommandType::CMD_USE_FRAMEBUFFER_READ, &use, sizeof(use));
+}
+
+void GLCommands::useFrameBufferDefault() {
+    this->useFrameBufferDraw(nullptr);
+    this->useFrameBufferRead(nullptr);
+}
+
+// -----------------------
+// GPU Commands: Rendering
+// -----------------------
+
+static void* elementsOffset(int offset, GPUDrawElements element) {
+    unsigned long bytes = offset;
+    switch (element) {
+        case GPUDrawElements::ELEMENTS_UNSIGNED_BYTE: break;
+        case GPUDrawElements::ELEMENTS_UNSIGNED_SHORT: bytes *= 2; break;
+        case GPUDrawElements::ELEMENTS_UNSIGNED_INT: bytes *= 4; break;
+    }
+
+    // Return Offset as Pointer
+    return (void*) bytes;
+}
+
+static GLCommandDraw drawCommand(GPUDrawPrimitive type, int offset, int count) {
+    GLCommandDraw draw = {};
+    draw.mode = toValue(type);
+    draw.offset = offset;
+    draw.count = count;
+    draw.instances = 1;
+    return draw;
+}
+
+static GLCommandDraw drawCommand(GPUDrawPrimitive type, int offset, int count, GPUDrawElements element) {
+    GLCommandDraw draw = drawCommand(type, offset, count);
+    draw.indices = elementsOffset(offset, element);
+    draw.type = toValue(element);
+    return draw;
+}
+
+void GLCommands::drawClear(GPUDrawClear clear) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandExecute execute = {};
+    execute.bits = toValue(clear);
+    this->recordCommand(GLCommandType::CMD_DRAW_CLEAR, &execute, sizeof(execute));
+}
+
+void GLCommands::drawArrays(GPUDrawPrimitive type, int offset, int count) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count);
+    this->recordCommand(GLCommandType::CMD_DRAW_ARRAYS, &draw, sizeof(draw));
+}
+
+void GLCommands::drawElements(GPUDrawPrimitive type, int offset, int count, GPUDrawElements element) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count, element);
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS, &draw, sizeof(draw));
+}
+
+void GLCommands::drawElementsBaseVertex(GPUDrawPrimitive type, int offset, int count, int base, GPUDrawElements element) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count, element);
+    draw.base = base;
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX, &draw, sizeof(draw));
+}
+
+void GLCommands::drawArraysInstanced(GPUDrawPrimitive type, int offset, int count, int instance_count) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count);
+    draw.instances = instance_count;
+    this->recordCommand(GLCommandType::CMD_DRAW_ARRAYS_INSTANCED, &draw, sizeof(draw));
+}
+
+void GLCommands::drawElementsInstanced(GPUDrawPrimitive type, int offset, int count, GPUDrawElements element, int instance_count) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count, element);
+    draw.instances = instance_count;
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS_INSTANCED, &draw, sizeof(draw));
+}
+
+void GLCommands::drawElementsBaseVertexInstanced(GPUDrawPrimitive type, int offset, int count, int base, GPUDrawElements element, int instance_count) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandDraw draw = drawCommand(type, offset, count, element);
+    draw.instances = instance_count;
+    draw.base = base;
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX_INSTANCED, &draw, sizeof(draw));
+}
+
+// ---------------------
+// GPU Commands: Compute
+// ---------------------
+
+static GLCommandIndirect indirectCommand(GPUBuffer* buffer, int offset) {
+    GLCommandIndirect indirect = {};
+    indirect.buffer = static_cast<GLBuffer*>(buffer);
+    indirect.offset = offset;
+    return indirect;
+}
+
+static bool indirectRange(GPUBuffer* buffer, int offset, long long bytes) {
+    // Driver Requires Aligned Offsets Inside Buffer
+    return buffer != nullptr && offset >= 0 && offset % 4 == 0 &&
+        offset + bytes <= (long long) buffer->getBytes();
+}
+
+void GLCommands::drawArraysIndirect(GPUDrawPrimitive type, GPUBuffer *indirect, int offset) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_draw_indirect) {
+        GPUReport::error("indirect draws are not supported");
+        return;
+    } else if (!indirectRange(indirect, offset, 16)) {
+        GPUReport::error("indirect draw requires a 4-byte aligned offset inside buffer");
+        return;
+    }
+
+    // Record Indirect Draw Arrays
+    GLCommandIndirect draw = indirectCommand(indirect, offset);
+    draw.mode = toValue(type);
+    this->recordCommand(GLCommandType::CMD_DRAW_ARRAYS_INDIRECT, &draw, sizeof(draw));
+}
+
+void GLCommands::drawElementsIndirect(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_draw_indirect) {
+        GPUReport::error("indirect draws are not supported");
+        return;
+    } else if (!indirectRange(indirect, offset, 20)) {
+        GPUReport::error("indirect draw requires a 4-byte aligned offset inside buffer");
+        return;
+    }
+
+    // Record Indirect Draw Elements
+    GLCommandIndirect draw = indirectCommand(indirect, offset);
+    draw.mode = toValue(type);
+    draw.type = toValue(element);
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT, &draw, sizeof(draw));
+}
+
+void GLCommands::multiDrawElementsIndirectCount(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset, GPUBuffer *count, int count_offset, int max_count, int stride) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_multi_draw_indirect || !GLAD_GL_ARB_indirect_parameters) {
+        GPUReport::error("indirect count draws are not supported");
+        return;
+    } else if (indirect == nullptr || count == nullptr) {
+        GPUReport::error("indirect count draw requires buffers");
+        return;
+    } else if (max_count < 0 || (stride != 0 && (stride < 20 || stride % 4 != 0))) {
+        GPUReport::error("indirect count stride is invalid");
+        return;
+    }
+
+    // Check Commands and Count Ranges
+    long long step = (stride != 0) ? stride : 20;
+    long long bytes = (max_count > 0) ? step * (max_count - 1) + 20 : 0;
+    if (!indirectRange(indirect, offset, bytes) || !indirectRange(count, count_offset, 4)) {
+        GPUReport::error("indirect count draw requires 4-byte aligned offsets inside buffers");
+        return;
+    }
+
+    // Record Indirect Draw Elements with GPU Count
+    GLCommandIndirect draw = indirectCommand(indirect, offset);
+    draw.mode = toValue(type);
+    draw.type = toValue(element);
+    draw.count = static_cast<GLBuffer*>(count);
+    draw.count_offset = count_offset;
+    draw.max_count = max_count;
+    draw.stride = stride;
+    this->recordCommand(GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT_COUNT, &draw, sizeof(draw));
+}
+
+void GLCommands::executeComputeSync(int x, int y, int z) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_compute_shader) {
+        GPUReport::error("compute shaders are not supported");
+        return;
+    }
+
+    // Record Dispatch and Wait Compute Writes
+    GLCommandExecute execute = {GL_ALL_BARRIER_BITS, x, y, z};
+    this->recordCommand(GLCommandType::CMD_EXECUTE_COMPUTE_SYNC, &execute, sizeof(execute));
+}
+
+void GLCommands::executeCompute(int x, int y, int z) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_compute_shader) {
+        GPUReport::error("compute shaders are not supported");
+        return;
+    }
+
+    // Record Dispatch Compute
+    GLCommandExecute execute = {0, x, y, z};
+    this->recordCommand(GLCommandType::CMD_EXECUTE_COMPUTE, &execute, sizeof(execute));
+}
+
+void GLCommands::executeComputeIndirect(GPUBuffer *indirect, int offset) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (!GLAD_GL_ARB_compute_shader) {
+        GPUReport::error("compute shaders are not supported");
+        return;
+    } else if (!indirectRange(indirect, offset, 12)) {
+        GPUReport::error("indirect dispatch requires a 4-byte aligned offset inside buffer");
+        return;
+    }
+
+    // Record Dispatch Compute from Buffer
+    GLCommandIndirect execute = indirectCommand(indirect, offset);
+    this->recordCommand(GLCommandType::CMD_EXECUTE_COMPUTE_INDIRECT, &execute, sizeof(execute));
+}
+
+void GLCommands::memoryBarrier(GPUMemoryBarrier from, GPUMemoryBarrier to) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (glMemoryBarrier == nullptr) {
+        GPUReport::error("memory barriers are not supported");
+        return;
+    }
+
+    // OpenGL Barriers Only Describe Next Usage, Writers
+    // are Tracked by Hazards so Source Usage is Ignored
+    (void) from;
+    GLCommandExecute execute = {};
+    execute.bits = toValue(to);
+    this->recordCommand(GLCommandType::CMD_MEMORY_BARRIER, &execute, sizeof(execute));
+}
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+void GLCommands::bundleObject(void* object) {
+    if (object == nullptr)
+        return;
+
+    // Ensure Objects Capacity
+    if (m_bundle_objects_count == m_bundle_objects_capacity) {
+        int capacity = (m_bundle_objects_capacity > 0) ? m_bundle_objects_capacity << 1 : 16;
+        m_bundle_objects = (void**) realloc(m_bundle_objects, capacity * sizeof(void*));
+        m_bundle_objects_capacity = capacity;
+    }
+
+    // Append Referenced Object
+    m_bundle_objects[m_bundle_objects_count++] = object;
+}
+
+bool GLCommands::bundleCommand(GLCommandType type, void* data, GLCommandsState &applied) {
+    switch (type) {
+        case GLCommandType::CMD_USE_PIPELINE:
+        case GLCommandType::CMD_USE_VERTEX_ARRAY:
+        case GLCommandType::CMD_USE_FRAMEBUFFER_DRAW:
+        case GLCommandType::CMD_USE_FRAMEBUFFER_READ:
+            bundleObject(((GLCommandObject*) data)->pipeline);
+            break;
+        case GLCommandType::CMD_USE_BLOCK_BINDING:
+            bundleObject(((GLBlockBinding*) data)->buffer);
+            break;
+        case GLCommandType::CMD_USE_TEXTURE:
+            bundleObject(((GLTextureActive*) data)->texture);
+            break;
+        // Samplers are Resolved at Each Draw
+        case GLCommandType::CMD_USE_TEXTURE_SAMPLER:
+            bundleObject(((GLCommandSampler*) data)->binding.texture);
+            bundleObject(((GLCommandSampler*) data)->binding.sampler);
+            return applyCommand(type, data);
+
+        // OpenGL Command Rendering
+        case GLCommandType::CMD_DRAW_CLEAR:
+        case GLCommandType::CMD_DRAW_ARRAYS:
+        case GLCommandType::CMD_DRAW_ARRAYS_INSTANCED:
+        case GLCommandType::CMD_DRAW_ELEMENTS:
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX:
+        case GLCommandType::CMD_DRAW_ELEMENTS_INSTANCED:
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX_INSTANCED:
+        case GLCommandType::CMD_EXECUTE_COMPUTE:
+        case GLCommandType::CMD_EXECUTE_COMPUTE_SYNC:
+            if (m_state.pipeline == nullptr) {
+                GPUReport::error("bundle draw requires a pipeline");
+                m_bundle_valid = false;
+            }
+
+            bakeBinds(applied);
+            return true;
+
+        // Indirect Commands Reference Buffers
+        case GLCommandType::CMD_DRAW_ARRAYS_INDIRECT:
+        case GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT:
+        case GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT_COUNT:
+        case GLCommandType::CMD_EXECUTE_COMPUTE_INDIRECT:
+            bundleObject(((GLCommandIndirect*) data)->buffer);
+            bundleObject(((GLCommandIndirect*) data)->count);
+            if (m_state.pipeline == nullptr) {
+                GPUReport::error("bundle draw requires a pipeline");
+                m_bundle_valid = false;
+            }
+
+            bakeBinds(applied);
+            return true;
+
+        // Queries are Reused by Each Replay
+        case GLCommandType::CMD_QUERY_BEGIN:
+        case GLCommandType::CMD_QUERY_END:
+        case GLCommandType::CMD_CONDITIONAL_BEGIN:
+            bundleObject(((GLCommandObject*) data)->query);
+            return true;
+
+        // Fences Must be Stamped Once
+        case GLCommandType::CMD_SYNC_FENCE:
+            GPUReport::error("bundle cannot stamp fences");
+            m_bundle_valid = false;
+            return true;
+
+        // Commands without State
+        default: return true;
+    }
+
+    // State Changes are Baked as Binds
+    applyCommand(type, data);
+    return false;
+}
+
+// --------------------------
+// GPU Commands: Bundle Binds
+// --------------------------
+
+void GLCommands::bakeBinds(GLCommandsState &applied) {
+    GLCommandsState* current = &m_state;
+    GLCommandObject use;
+
+    // Bind Objects Changed since Previous Draw
+    if (applied.pipeline != current->pipeline) {
+        use.pipeline = current->pipeline;
+        recordCommand(GLCommandType::CMD_BAKED_PIPELINE, &use, sizeof(use));
+        applied.pipeline = current->pipeline;
+    }
+
+    if (applied.vertex_array != current->vertex_array) {
+        use.vertex_array = current->vertex_array;
+        recordCommand(GLCommandType::CMD_BAKED_VERTEX_ARRAY, &use, sizeof(use));
+        applied.vertex_array = current->vertex_array;
+    }
+
+    // Bind Changed Block Bindings
+    for (GLBlockBinding binding : current->block_bindings) {
+        unsigned int key = (binding.target << 16) | binding.index;
+        GLBlockBinding* found = applied.block_bindings.get_key(key);
+        if (found && memcmp(found, &binding, sizeof(GLBlockBinding)) == 0)
+            continue;
+
+        recordCommand(GLCommandType::CMD_BAKED_BLOCK_BINDING, &binding, sizeof(binding));
+        applied.block_bindings.replace_key(key, binding);
+    }
+
+    // Forget Removed Texture Units
+    for (GLTextureActive active : applied.texture_actives) {
+        if (current->texture_actives.check_key(active.unit))
+            continue;
+
+        active.texture = nullptr;
+        recordCommand(GLCommandType::CMD_BAKED_TEXTURE, &active, sizeof(active));
+    }
+
+    // Bind Changed Texture Units
+    for (GLTextureActive active : current->texture_actives) {
+        GLTextureActive* found = applied.texture_actives.get_key(active.unit);
+        if (found && found->texture == active.texture)
+            continue;
+
+        recordCommand(GLCommandType::CMD_BAKED_TEXTURE, &active, sizeof(active));
+    }
+
+    // Applied Units Now Match Current Units
+    applied.texture_actives = current->texture_actives;
+    // Bind Changed Framebuffers
+    if (applied.framebuffer_draw != current->framebuffer_draw) {
+        use.framebuffer = current->framebuffer_draw;
+        recordCommand(GLCommandType::CMD_BAKED_FRAMEBUFFER_DRAW, &use, sizeof(use));
+        applied.framebuffer_draw = current->framebuffer_draw;
+    }
+
+    if (applied.framebuffer_read != current->framebuffer_read) {
+        use.framebuffer = current->framebuffer_read;
+        recordCommand(GLCommandType::CMD_BAKED_FRAMEBUFFER_READ, &use, sizeof(use));
+        applied.framebuffer_read = current->framebuffer_read;
+    }
+}
+
+// -------------------------
+// GPU Commands: Bundle Bake
+// -------------------------
+
+void GLCommands::bakeBundle() {
+    GLCommandsState applied;
+    m_state = GLCommandsState();
+    m_bundle_objects_count = 0;
+    m_bundle_valid = true;
+
+    // Bake into Spare Arena, Keep Records as Source
+    unsigned char* source = m_arena;
+    unsigned int source_bytes = m_arena_bytes;
+    unsigned int source_capacity = m_arena_capacity;
+    m_arena = m_bake;
+    m_arena_bytes = 0;
+    m_arena_capacity = m_bake_capacity;
+    m_bake = source;
+    m_bake_capacity = source_capacity;
+
+    // Resolve Records Against Entry State
+    unsigned char* cursor = source;
+    unsigned char* end = source + source_bytes;
+    while (cursor < end) {
+        GLCommandRecord* record = (GLCommandRecord*) cursor;
+        unsigned int bytes = record->bytes;
+        if (bundleCommand(record->type, record + 1, applied))
+            recordCommand(record->type, record + 1, bytes - sizeof(GLCommandRecord));
+        cursor += bytes;
+    }
+
+    // Sort Objects for Invalidation Lookup
+    void** objects = m_bundle_objects;
+    std::sort(objects, objects + m_bundle_objects_count);
+    m_bundle_objects_count = std::unique(objects,
+        objects + m_bundle_objects_count) - objects;
+}
+
+bool GLCommands::checkBundle(void* object) {
+    void** objects = m_bundle_objects;
+    void** end = objects + m_bundle_objects_count;
+    return std::binary_search(objects, end, object);
+}
@@ -5,36 +5,41 @@
 #include "private/context.h"
 #include "private/glad.h"
 
-GLFence::GLFence(GLContext* ctx) {
-    ctx->makeCurrent(this);
-
-    // Stamp Fence Sync
-    m_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+GLFence::GLFence(GLContext* ctx, GLsync sync) {
+    m_sync = sync;
     m_ctx = ctx;
+    // Fence Pool Chain
+    m_next = nullptr;
+    m_value = 0;
+    m_recorded = false;
+    m_destroyed = false;
 }
 
 void GLFence::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
 
-    // Destroy Fence Sync
     if (m_sync) glDeleteSync(m_sync);
-    delete this;
+    m_sync = nullptr;
+    // Recorded Fence is Recycled when Commands Rewind
+    if (m_recorded) {
+        m_destroyed = true;
+        return;
+    }
+
+    // Recycle Fence Object
+    m_ctx->releaseFence(this);
 }
 
 // -----------------------
 // GLFence: Syncronization
 // -----------------------
 
-void GLFence::waitCPU() {
-    m_ctx->makeCurrent(this);
-    if (m_sync == nullptr)
-        return;
-
+static void waitSync(GLsync sync) {
 	GLbitfield flags = 0;
 	GLuint64 duration = 0;
     // Stall CPU until Fence Signaled
 	while (true) {
-		GLenum status = glClientWaitSync(m_sync, flags, duration);
+		GLenum status = glClientWaitSync(sync, flags, duration);
 		if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
 			break;
 		if (status == GL_WAIT_FAILED) {
@@ -48,8 +53,33 @@ void GLFence::waitCPU() {
 	}
 }
 
+static bool checkSync(GLsync sync) {
+	GLenum status = glClientWaitSync(sync, 0, 0);
+	if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+		return true;
+	if (status == GL_WAIT_FAILED) {
+        GPUReport::warning("failed fence sync");
+		return true;
+    }
+
+    // Not Completed Yet
+	return false;
+}
+
+void GLFence::waitCPU() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (this->unstamped()) {
+        GPUReport::error("fence commands were not submitted");
+        return;
+    }
+
+    // Wait Stamped Fence
+    if (m_sync != nullptr)
+        waitSync(m_sync);
+}
+
 void GLFence::waitGPU() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
 
     // Stall GL Queue until Fence Signaled
     if (m_sync != nullptr)
@@ -57,32 +87,170 @@ void GLFence::waitGPU() {
 }
 
 bool GLFence::completed() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    return signaled();
+}
+
+bool GLFence::unstamped() {
+    return m_sync == nullptr && m_recorded && !m_destroyed;
+}
+
+bool GLFence::signaled() {
+    // Recorded Fence is Pending until Replayed
     if (m_sync == nullptr)
-        return true;
+        return !this->unstamped();
 
-	GLenum status = glClientWaitSync(m_sync, 0, 0);
-	if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
-		return true;
-	if (status == GL_WAIT_FAILED) {
-        GPUReport::warning("failed fence sync");
-		return true;
+    // Check Fence without Waiting
+    return checkSync(m_sync);
+}
+
+// -----------------------
+// GPU Context: Fence Pool
+// -----------------------
+
+GLFence* GLContext::acquireFence(GLsync sync) {
+    GLFence* fence = nullptr;
+    {
+        // Commands may be Recorded on Other Threads
+        std::lock_guard<std::mutex> lock(m_fence_mutex);
+        fence = m_fence_pool;
+        if (fence != nullptr)
+            m_fence_pool = fence->m_next;
     }
 
-    // Not Completed Yet
-	return false;
+    // Allocate Fence when Pool is Empty
+    if (fence == nullptr)
+        return new GLFence(this, sync);
+    fence->m_sync = sync;
+    fence->m_next = nullptr;
+    fence->m_value = 0;
+    fence->m_recorded = false;
+    fence->m_destroyed = false;
+    return fence;
+}
+
+void GLContext::releaseFence(GLFence* fence) {
+    std::lock_guard<std::mutex> lock(m_fence_mutex);
+    fence->m_sync = nullptr;
+    fence->m_next = m_fence_pool;
+    m_fence_pool = fence;
+}
+
+void GLContext::disposeFences() {
+    // Delete Pending Timeline Syncs
+    GLFence* fence = m_timeline_first;
+    while (fence != nullptr) {
+        GLFence* next = fence->m_next;
+        glDeleteSync(fence->m_sync);
+        delete fence;
+        fence = next;
+    }
+
+    // Delete Pooled Fences
+    fence = m_fence_pool;
+    while (fence != nullptr) {
+        GLFence* next = fence->m_next;
+        delete fence;
+        fence = next;
+    }
+
+    m_timeline_first = nullptr;
+    m_timeline_last = nullptr;
+    m_fence_pool = nullptr;
+}
+
+// ---------------------------
+// GPU Context: Fence Timeline
+// ---------------------------
+
+unsigned long long GLContext::signal() {
+    GPUTraceScope trace = makeCurrent(this);
+    GLFence* fence = acquireFence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    fence->m_value = ++m_timeline_value;
+
+    // Append Fence to Timeline
+    if (m_timeline_last != nullptr)
+        m_timeline_last->m_next = fence;
+    else m_timeline_first = fence;
+    m_timeline_last = fence;
+    return fence->m_value;
 }
 
+void GLContext::retireTimeline(unsigned long long value) {
+    GLFence* fence = m_timeline_first;
+    while (fence != nullptr) {
+        // Stop at First Pending Fence
+        if (fence->m_value > value && !checkSync(fence->m_sync))
+            break;
+        if (fence->m_value <= value)
+            waitSync(fence->m_sync);
+
+        // Recycle Completed Fence
+        m_timeline_completed = fence->m_value;
+        m_timeline_first = fence->m_next;
+        glDeleteSync(fence->m_sync);
+        releaseFence(fence);
+        fence = m_timeline_first;
+    }
+
+    if (m_timeline_first == nullptr)
+        m_timeline_last = nullptr;
+}
+
+void GLContext::waitUntil(unsigned long long value) {
+    GPUTraceScope trace = makeCurrent(this);
+    if (value > m_timeline_value) {
+        GPUReport::error("timeline value %llu was not signaled", value);
+        return;
+    }
+
+    // Wait Fences until Value
+    if (value > m_timeline_completed)
+        retireTimeline(value);
+}
+
+unsigned long long GLContext::completedValue() {
+    GPUTraceScope trace = makeCurrent(this);
+    retireTimeline(m_timeline_completed);
+    return m_timeline_completed;
+}
 
 // -----------------
 // GLFence: Creation
 // -----------------
 
 GPUFence* GLCommands::syncFence() {
-    m_ctx->makeCurrent(this);
-    return new GLFence(m_ctx);
+    if (!m_recording.load(std::memory_order_relaxed)) {
+        GPUTraceScope trace = m_ctx->makeCurrent(this);
+        return m_ctx->acquireFence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+
+    // Stamp Fence when Commands are Replayed
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandObject use;
+    use.fence = m_ctx->acquireFence(nullptr);
+    use.fence->m_recorded = true;
+    this->recordCommand(GLCommandType::CMD_SYNC_FENCE, &use, sizeof(use));
+    return use.fence;
+}
+
+void GLCommands::rewindFences() {
+    unsigned char* cursor = m_arena;
+    unsigned char* end = m_arena + m_arena_bytes;
+    // Release Fences Destroyed while Recorded
+    while (cursor < end) {
+        GLCommandRecord* record = (GLCommandRecord*) cursor;
+        if (record->type == GLCommandType::CMD_SYNC_FENCE) {
+            GLFence* fence = ((GLCommandObject*) (record + 1))->fence;
+            fence->m_recorded = false;
+            if (fence->m_destroyed)
+                m_ctx->releaseFence(fence);
+        }
+
+        cursor += record->bytes;
+    }
 }
 
 GPUFence* GLContext::syncFence() {
-    return new GLFence(this);
+    return acquireFence(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
 }
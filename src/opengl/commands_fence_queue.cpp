@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/context.h"
+#include <cstdlib>
+
+GLFenceQueue::GLFenceQueue(GLContext* ctx) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
+    m_entries = nullptr;
+    m_head = m_count = 0;
+    m_capacity = 0;
+    m_ctx = ctx;
+
+    // Register Queue for Surface Swap Polling
+    m_prev = nullptr;
+    m_next = ctx->m_fence_queues;
+    if (m_next != nullptr)
+        m_next->m_prev = this;
+    ctx->m_fence_queues = this;
+}
+
+void GLFenceQueue::destroy() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    // Pending Callbacks are Discarded
+    for (int i = 0; i < m_count; i++) {
+        GLFenceEntry* entry = m_entries + (m_head + i) % m_capacity;
+        entry->fence->destroy();
+    }
+
+    // Unregister Queue from Context
+    if (m_prev != nullptr)
+        m_prev->m_next = m_next;
+    else m_ctx->m_fence_queues = m_next;
+    if (m_next != nullptr)
+        m_next->m_prev = m_prev;
+
+    // Dealloc Object
+    free(m_entries);
+    delete this;
+}
+
+void GLFenceQueue::fire(GLFenceEntry* entry) {
+    // Queue Owns Fence after Push
+    entry->fence->destroy();
+    if (entry->cb != nullptr)
+        entry->cb(entry->userdata);
+}
+
+// --------------------------
+// GPU Fence Queue: Recording
+// --------------------------
+
+void GLFenceQueue::push(GPUFence* fence, GPUFenceCallback cb, void* userdata) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (fence == nullptr) {
+        GPUReport::error("fence queue requires a fence");
+        return;
+    }
+
+    // Grow Ring Keeping Submission Order
+    if (m_count == m_capacity) {
+        int capacity = (m_capacity > 0) ? m_capacity << 1 : 16;
+        GLFenceEntry* entries = (GLFenceEntry*) malloc(capacity * sizeof(GLFenceEntry));
+        for (int i = 0; i < m_count; i++)
+            entries[i] = m_entries[(m_head + i) % m_capacity];
+        free(m_entries);
+        m_entries = entries;
+        m_capacity = capacity;
+        m_head = 0;
+    }
+
+    // Append Entry at Ring Tail
+    GLFenceEntry* entry = m_entries + (m_head + m_count) % m_capacity;
+    entry->fence = static_cast<GLFence*>(fence);
+    entry->cb = cb;
+    entry->userdata = userdata;
+    m_count++;
+}
+
+// ------------------------
+// GPU Fence Queue: Polling
+// ------------------------
+
+int GLFenceQueue::pollQueue() {
+    int fired = 0;
+    // Check Oldest Fences without Waiting
+    while (m_count > 0) {
+        GLFenceEntry entry = m_entries[m_head];
+        if (!entry.fence->signaled())
+            break;
+
+        // Pop Entry before Callback may Push Again
+        m_head = (m_head + 1) % m_capacity;
+        m_count--;
+        this->fire(&entry);
+        fired++;
+    }
+
+    return fired;
+}
+
+int GLFenceQueue::poll() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    return this->pollQueue();
+}
+
+void GLFenceQueue::finish() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    while (m_count > 0) {
+        GLFenceEntry entry = m_entries[m_head];
+        if (entry.fence->unstamped()) {
+            GPUReport::error("fence queue has commands not submitted");
+            break;
+        }
+
+        // Stall until Fence Signaled
+        m_head = (m_head + 1) % m_capacity;
+        m_count--;
+        entry.fence->waitCPU();
+        this->fire(&entry);
+    }
+}
+
+void GLContext::pollFenceQueues() {
+    GLFenceQueue* queue = m_fence_queues;
+    while (queue != nullptr) {
+        GLFenceQueue* next = queue->m_next;
+        queue->pollQueue();
+        queue = next;
+    }
+}
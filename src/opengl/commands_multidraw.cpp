@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/glad.h"
+#include <cstdlib>
+
+static bool checkCoalesce(GLCommandType type) {
+    switch (type) {
+        case GLCommandType::CMD_DRAW_ARRAYS:
+        case GLCommandType::CMD_DRAW_ELEMENTS:
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX:
+            return true;
+        // Instanced Draws are not Coalesced
+        default: return false;
+    }
+}
+
+static bool checkCompatible(GLCommandDraw* first, GLCommandDraw* draw) {
+    return first->mode == draw->mode && first->type == draw->type;
+}
+
+// ---------------------------------
+// GPU Commands: Multi-Draw Coalesce
+// ---------------------------------
+
+unsigned char* GLCommands::coalesceDraws(unsigned char* cursor, unsigned char* end) {
+    GLCommandsCounters* counters = &m_ctx_state->m_commands_counters;
+    GLCommandRecord* record = (GLCommandRecord*) cursor;
+    GLCommandType type = record->type;
+    GLCommandDraw* first = (GLCommandDraw*) (record + 1);
+
+    // Find Run of Consecutive Compatible Draws
+    int count = 0;
+    unsigned char* next = cursor;
+    if (checkCoalesce(type) && !m_ctx_state->hazardWrites(m_state)) {
+        while (next < end) {
+            GLCommandRecord* check = (GLCommandRecord*) next;
+            if (check->type != type || !checkCompatible(first, (GLCommandDraw*) (check + 1)))
+                break;
+            next += check->bytes;
+            count++;
+        }
+    }
+
+    // Single Draws Replay Directly
+    if (count <= 1) {
+        this->executeCommand(type, first, true);
+        counters->draws_recorded++;
+        counters->draws_issued++;
+        return cursor + record->bytes;
+    }
+
+    // Ensure Multi-Draw Arrays Capacity
+    if (count > m_multi_capacity) {
+        int capacity = (m_multi_capacity > 0) ? m_multi_capacity : 64;
+        while (capacity < count)
+            capacity <<= 1;
+        // Pack Arrays in One Allocation
+        unsigned char* block = (unsigned char*) realloc(m_multi_indices,
+            capacity * (sizeof(GLint) * 3 + sizeof(void*)));
+        m_multi_indices = (void**) block;
+        m_multi_first = (GLint*) (m_multi_indices + capacity);
+        m_multi_count = m_multi_first + capacity;
+        m_multi_base = m_multi_count + capacity;
+        m_multi_capacity = capacity;
+    }
+
+    // Pack Per-Draw Parameters
+    int i = 0;
+    for (unsigned char* c = cursor; c < next; i++) {
+        GLCommandRecord* check = (GLCommandRecord*) c;
+        GLCommandDraw* draw = (GLCommandDraw*) (check + 1);
+        m_multi_first[i] = draw->offset;
+        m_multi_count[i] = draw->count;
+        m_multi_base[i] = draw->base;
+        m_multi_indices[i] = draw->indices;
+        c += check->bytes;
+    }
+
+    counters->draws_recorded += count;
+    if (!this->prepareShaders(true))
+        return next;
+
+    // Issue Single Multi-Draw
+    switch (type) {
+        case GLCommandType::CMD_DRAW_ARRAYS:
+            glMultiDrawArrays(first->mode, m_multi_first, m_multi_count, count);
+            break;
+        case GLCommandType::CMD_DRAW_ELEMENTS:
+            glMultiDrawElements(first->mode, m_multi_count, first->type,
+                m_multi_indices, count);
+            break;
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX:
+            glMultiDrawElementsBaseVertex(first->mode, m_multi_count, first->type,
+                m_multi_indices, count, m_multi_base);
+            break;
+        default: break;
+    }
+
+    counters->draws_issued++;
+    return next;
+}
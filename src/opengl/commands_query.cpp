@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/context.h"
+#include "private/glad.h"
+
+GLQuery::GLQuery(GLContext* ctx, GPUQueryType type) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
+    m_target = toValue(type);
+    m_active = false;
+    m_type = type;
+    m_ctx = ctx;
+
+    // Prefer Conservative Occlusion when Available
+    if (type == GPUQueryType::QUERY_OCCLUSION && GLAD_GL_ARB_ES3_compatibility)
+        m_target = GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
+    glGenQueries(1, &m_query);
+}
+
+void GLQuery::destroy() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    glDeleteQueries(1, &m_query);
+    m_ctx->manipulateState()->invalidateBundles(this);
+
+    // Dealloc Object
+    delete this;
+}
+
+GPUQuery* GLContext::createQuery(GPUQueryType type) {
+    GPUTraceScope trace = makeCurrent(this);
+    bool statistics = type >= GPUQueryType::QUERY_VERTICES_SUBMITTED;
+    if (statistics && !GLAD_GL_ARB_pipeline_statistics_query) {
+        GPUReport::error("pipeline statistics queries are not supported");
+        return nullptr;
+    }
+
+    // Create Query Object
+    return new GLQuery(this, type);
+}
+
+// ---------------------
+// GLQuery: Query Result
+// ---------------------
+
+bool GLQuery::available() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    GLint available = 0;
+    glGetQueryObjectiv(m_query, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available != 0;
+}
+
+unsigned long long GLQuery::result() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (m_active) {
+        GPUReport::error("query is still active");
+        return 0;
+    }
+
+    // Wait Query Result
+    GLuint64 value = 0;
+    glGetQueryObjectui64v(m_query, GL_QUERY_RESULT, &value);
+    return value;
+}
+
+GPUQueryType GLQuery::getType() {
+    return m_type;
+}
+
+// ---------------------
+// GPU Commands: Queries
+// ---------------------
+
+void GLCommands::beginQuery(GPUQuery *query) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (query == nullptr) {
+        GPUReport::error("query is not valid");
+        return;
+    }
+
+    // Record Query Begin
+    GLCommandObject use;
+    use.query = static_cast<GLQuery*>(query);
+    this->recordCommand(GLCommandType::CMD_QUERY_BEGIN, &use, sizeof(use));
+}
+
+void GLCommands::endQuery(GPUQuery *query) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (query == nullptr) {
+        GPUReport::error("query is not valid");
+        return;
+    }
+
+    // Record Query End
+    GLCommandObject use;
+    use.query = static_cast<GLQuery*>(query);
+    this->recordCommand(GLCommandType::CMD_QUERY_END, &use, sizeof(use));
+}
+
+void GLCommands::beginConditional(GPUQuery *query) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    if (query == nullptr || query->getType() != GPUQueryType::QUERY_OCCLUSION) {
+        GPUReport::error("conditional rendering requires an occlusion query");
+        return;
+    }
+
+    // Record Conditional Begin
+    GLCommandObject use;
+    use.query = static_cast<GLQuery*>(query);
+    this->recordCommand(GLCommandType::CMD_CONDITIONAL_BEGIN, &use, sizeof(use));
+}
+
+void GLCommands::endConditional() {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    this->recordCommand(GLCommandType::CMD_CONDITIONAL_END, nullptr, 0);
+}
+
+// ----------------------------
+// GPU Commands: Queries Replay
+// ----------------------------
+
+void GLCommands::executeQuery(GLCommandType type, GLQuery* query) {
+    switch (type) {
+        case GLCommandType::CMD_QUERY_BEGIN:
+            if (query->m_active) {
+                GPUReport::error("query is already active");
+                break;
+            }
+
+            glBeginQuery(query->m_target, query->m_query);
+            query->m_active = true;
+            break;
+
+        case GLCommandType::CMD_QUERY_END:
+            if (!query->m_active) {
+                GPUReport::error("query is not active");
+                break;
+            }
+
+            glEndQuery(query->m_target);
+            query->m_active = false;
+            break;
+
+        // Skip Draws on GPU without Readback
+        case GLCommandType::CMD_CONDITIONAL_BEGIN:
+            glBeginConditionalRender(query->m_query, GL_QUERY_NO_WAIT);
+            break;
+        case GLCommandType::CMD_CONDITIONAL_END:
+            glEndConditionalRender();
+            break;
+
+        // Not a Query Command
+        default: break;
+    }
+}
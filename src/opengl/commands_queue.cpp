@@ -0,0 +1,345 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/context.h"
+#include "private/pipeline.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+
+GLDrawQueue::GLDrawQueue(GLContext* ctx) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
+    m_items = nullptr;
+    m_textures = nullptr;
+    m_bindings = nullptr;
+    m_items_count = m_items_capacity = 0;
+    m_textures_count = m_textures_capacity = 0;
+    m_bindings_count = m_bindings_capacity = 0;
+    // Draw Queue Render Targets
+    m_targets = nullptr;
+    m_targets_count = m_targets_capacity = 0;
+    // Draw Queue Sorting
+    m_keys = nullptr;
+    m_order = nullptr;
+    m_sort_capacity = 0;
+    m_stats = {};
+    m_ctx = ctx;
+}
+
+void GLDrawQueue::destroy() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    free(m_items);
+    free(m_textures);
+    free(m_bindings);
+    free(m_targets);
+    free(m_keys);
+    free(m_order);
+
+    // Dealloc Object
+    delete this;
+}
+
+static void* growArray(void* data, int &capacity, int needed, int bytes) {
+    if (needed <= capacity)
+        return data;
+
+    // Double Capacity Until Fits
+    int capacity0 = (capacity > 0) ? capacity : 64;
+    while (capacity0 < needed)
+        capacity0 <<= 1;
+    capacity = capacity0;
+    return realloc(data, capacity0 * bytes);
+}
+
+// -------------------------
+// GPU Draw Queue: Recording
+// -------------------------
+
+void GLDrawQueue::clearQueue() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    m_items_count = 0;
+    m_textures_count = 0;
+    m_bindings_count = 0;
+    m_targets_count = 0;
+}
+
+int GLDrawQueue::targetOrdinal(GPUFrameBuffer* framebuffer) {
+    // Reuse Previous Draw Render Target
+    if (m_items_count > 0) {
+        GLDrawItem* last = m_items + m_items_count - 1;
+        if (last->item.framebuffer == framebuffer)
+            return last->target;
+    }
+
+    // Find Render Target by First Appearance
+    for (int i = 0; i < m_targets_count; i++)
+        if (m_targets[i] == framebuffer)
+            return i;
+
+    // Register New Render Target
+    m_targets = (GPUFrameBuffer**) growArray(m_targets, m_targets_capacity,
+        m_targets_count + 1, sizeof(GPUFrameBuffer*));
+    m_targets[m_targets_count] = framebuffer;
+    return m_targets_count++;
+}
+
+void GLDrawQueue::pushDraw(GPUDrawItem item) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    if (item.pipeline == nullptr) {
+        GPUReport::error("draw item requires a pipeline");
+        return;
+    }
+
+    // Ensure Queue Capacity
+    m_items = (GLDrawItem*) growArray(m_items, m_items_capacity,
+        m_items_count + 1, sizeof(GLDrawItem));
+    m_textures = (GPUDrawTexture*) growArray(m_textures, m_textures_capacity,
+        m_textures_count + item.textures_count, sizeof(GPUDrawTexture));
+    m_bindings = (GPUDrawBinding*) growArray(m_bindings, m_bindings_capacity,
+        m_bindings_count + item.bindings_count, sizeof(GPUDrawBinding));
+
+    // Copy Textures and Bindings
+    int target = this->targetOrdinal(item.framebuffer);
+    GLDrawItem* draw = m_items + m_items_count++;
+    draw->target = target;
+    draw->textures_offset = m_textures_count;
+    draw->bindings_offset = m_bindings_count;
+    if (item.textures_count > 0)
+        memcpy(m_textures + m_textures_count, item.textures,
+            sizeof(GPUDrawTexture) * item.textures_count);
+    if (item.bindings_count > 0)
+        memcpy(m_bindings + m_bindings_count, item.bindings,
+            sizeof(GPUDrawBinding) * item.bindings_count);
+
+    // Store Draw Item
+    m_textures_count += item.textures_count;
+    m_bindings_count += item.bindings_count;
+    item.textures = nullptr;
+    item.bindings = nullptr;
+    draw->item = item;
+}
+
+GPUDrawQueueStats GLDrawQueue::getStats() {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    return m_stats;
+}
+
+// -----------------------
+// GPU Draw Queue: Sorting
+// -----------------------
+
+static unsigned long long foldBits(unsigned long long value, int bits) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    // Take Highest Mixed Bits
+    return value >> (64 - bits);
+}
+
+unsigned long long GLDrawQueue::computeKey(GLDrawItem* draw) {
+    GPUDrawItem* item = &draw->item;
+    GLPipeline* pipeline = static_cast<GLPipeline*>(item->pipeline);
+    m_ctx->manipulateState()->preparePipeline(pipeline);
+    GLPipelineObject* object = pipeline->m_object;
+
+    // Hash Texture Units
+    unsigned long long textures = 14695981039346656037ull;
+    GPUDrawTexture* units = m_textures + draw->textures_offset;
+    for (int i = 0; i < item->textures_count; i++) {
+        textures ^= (uintptr_t) units[i].texture + units[i].index;
+        textures *= 1099511628211ull;
+    }
+
+    // Render Target > Program > Pipeline > Textures > Vertex Array
+    unsigned long long key = 0;
+    key |= (unsigned long long) draw->target << 56;
+    key |= foldBits((uintptr_t) object->state.program, 12) << 44;
+    key |= foldBits(object->hash, 16) << 28;
+    key |= foldBits(textures, 16) << 12;
+    key |= foldBits((uintptr_t) item->vertex_array, 12);
+    return key;
+}
+
+void GLDrawQueue::sortQueue() {
+    int count = m_items_count;
+    unsigned long long* keys0 = m_keys;
+    unsigned long long* keys1 = m_keys + count;
+    unsigned int* order0 = m_order;
+    unsigned int* order1 = m_order + count;
+
+    // Stable Radix Sort by Bytes
+    for (int shift = 0; shift < 64; shift += 8) {
+        int counts[256] = {};
+        for (int i = 0; i < count; i++)
+            counts[(keys0[i] >> shift) & 0xFF]++;
+        // Skip when Every Key Shares Byte
+        if (counts[(keys0[0] >> shift) & 0xFF] == count)
+            continue;
+
+        int offset = 0;
+        for (int i = 0; i < 256; i++) {
+            int c = counts[i];
+            counts[i] = offset;
+            offset += c;
+        }
+
+        // Scatter Keys and Order
+        for (int i = 0; i < count; i++) {
+            int idx = counts[(keys0[i] >> shift) & 0xFF]++;
+            keys1[idx] = keys0[i];
+            order1[idx] = order0[i];
+        }
+
+        // Swap Sorting Buffers
+        unsigned long long* keys = keys0;
+        unsigned int* order = order0;
+        keys0 = keys1; keys1 = keys;
+        order0 = order1; order1 = order;
+    }
+
+    // Place Sorted Order at Front
+    if (order0 != m_order)
+        memcpy(m_order, order0, sizeof(unsigned int) * count);
+}
+
+// -----------------------
+// GPU Draw Queue: Changes
+// -----------------------
+
+static bool sameTextures(GPUDrawTexture* a, int a_count, GPUDrawTexture* b, int b_count) {
+    if (a_count != b_count)
+        return false;
+
+    // Compare Fields to Avoid Padding
+    for (int i = 0; i < a_count; i++)
+        if (a[i].texture != b[i].texture || a[i].index != b[i].index)
+            return false;
+    return true;
+}
+
+static bool sameBindings(GPUDrawBinding* a, int a_count, GPUDrawBinding* b, int b_count) {
+    return a_count == b_count && memcmp(a, b, sizeof(GPUDrawBinding) * a_count) == 0;
+}
+
+int GLDrawQueue::countChanges(unsigned int* order) {
+    int changes = 0;
+    GLDrawItem* prev = nullptr;
+    for (int i = 0; i < m_items_count; i++) {
+        GLDrawItem* draw = m_items + order[i];
+        GPUDrawItem* item = &draw->item;
+        if (prev == nullptr) {
+            prev = draw;
+            continue;
+        }
+
+        // Count Each State Change
+        GPUDrawItem* last = &prev->item;
+        changes += last->framebuffer != item->framebuffer;
+        changes += last->pipeline != item->pipeline;
+        changes += last->vertex_array != item->vertex_array;
+        changes += !sameTextures(
+            m_textures + prev->textures_offset, last->textures_count,
+            m_textures + draw->textures_offset, item->textures_count);
+        changes += !sameBindings(
+            m_bindings + prev->bindings_offset, last->bindings_count,
+            m_bindings + draw->bindings_offset, item->bindings_count);
+        prev = draw;
+    }
+
+    return changes;
+}
+
+// ------------------------
+// GPU Draw Queue: Dispatch
+// ------------------------
+
+static void emitDraw(GPUCommands* commands, GPUDrawItem* item) {
+    bool instanced = item->instance_count > 1;
+    if (!item->indexed) {
+        if (instanced) commands->drawArraysInstanced(
+            item->primitive, item->offset, item->count, item->instance_count);
+        else commands->drawArrays(item->primitive, item->offset, item->count);
+    } else if (item->base != 0) {
+        if (instanced) commands->drawElementsBaseVertexInstanced(item->primitive,
+            item->offset, item->count, item->base, item->element, item->instance_count);
+        else commands->drawElementsBaseVertex(item->primitive,
+            item->offset, item->count, item->base, item->element);
+    } else {
+        if (instanced) commands->drawElementsInstanced(item->primitive,
+            item->offset, item->count, item->element, item->instance_count);
+        else commands->drawElements(item->primitive,
+            item->offset, item->count, item->element);
+    }
+}
+
+void GLDrawQueue::dispatchQueue(GPUCommands* commands, GPUDrawQueueMode mode) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    int count = m_items_count;
+    m_stats = {};
+    if (count == 0)
+        return;
+
+    // Prepare Submission Order
+    if (count * 2 > m_sort_capacity) {
+        m_keys = (unsigned long long*) growArray(m_keys, m_sort_capacity, count * 2, sizeof(unsigned long long));
+        m_order = (unsigned int*) realloc(m_order, m_sort_capacity * sizeof(unsigned int));
+    }
+
+    for (int i = 0; i < count; i++)
+        m_order[i] = i;
+
+    // Sort by State Keys
+    int unsorted = countChanges(m_order);
+    // Render Target Ordinals Must Fit Highest Key Byte
+    if (mode == GPUDrawQueueMode::QUEUE_SORTED && m_targets_count <= 256) {
+        for (int i = 0; i < count; i++)
+            m_keys[i] = computeKey(m_items + i);
+        sortQueue();
+    }
+
+    GLDrawItem* prev = nullptr;
+    for (int i = 0; i < count; i++) {
+        GLDrawItem* draw = m_items + m_order[i];
+        GPUDrawItem* item = &draw->item;
+        GPUDrawItem* last = (prev) ? &prev->item : nullptr;
+
+        // Use Changed Framebuffer, Pipeline and Vertex Array
+        if (!last || last->framebuffer != item->framebuffer) {
+            if (item->framebuffer) commands->useFrameBuffer(item->framebuffer);
+            else commands->useFrameBufferDefault();
+        }
+        if (!last || last->pipeline != item->pipeline)
+            commands->usePipeline(item->pipeline);
+        if (!last || last->vertex_array != item->vertex_array)
+            commands->useVertexArray(item->vertex_array);
+
+        // Use Changed Textures
+        GPUDrawTexture* textures = m_textures + draw->textures_offset;
+        if (!last || !sameTextures(m_textures + prev->textures_offset,
+            last->textures_count, textures, item->textures_count)) {
+                for (int j = 0; j < item->textures_count; j++)
+                    commands->useTexture(textures[j].texture, textures[j].index);
+            }
+
+        // Use Changed Block Bindings
+        GPUDrawBinding* bindings = m_bindings + draw->bindings_offset;
+        if (!last || !sameBindings(m_bindings + prev->bindings_offset,
+            last->bindings_count, bindings, item->bindings_count)) {
+                for (int j = 0; j < item->bindings_count; j++) {
+                    GPUDrawBinding* b = bindings + j;
+                    commands->useBlockBindingRange(b->buffer, b->bind, b->index, b->offset, b->size);
+                }
+            }
+
+        // Emit Draw Call
+        emitDraw(commands, item);
+        prev = draw;
+    }
+
+    // Report Saved State Changes
+    int changes = countChanges(m_order);
+    m_stats.draws = count;
+    m_stats.changes = changes;
+    m_stats.saved = unsorted - changes;
+}
@@ -0,0 +1,372 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/context.h"
+#include "private/glad.h"
+#include <cstdlib>
+#include <cstring>
+
+static bool isStateCommand(GLCommandType type) {
+    return type <= GLCommandType::CMD_USE_FRAMEBUFFER_READ;
+}
+
+static bool isBakedCommand(GLCommandType type) {
+    return type >= GLCommandType::CMD_BAKED_PIPELINE;
+}
+
+static bool isDrawCommand(GLCommandType type) {
+    return type >= GLCommandType::CMD_DRAW_ARRAYS &&
+        type <= GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX_INSTANCED;
+}
+
+void GLCommands::recordCommand(GLCommandType type, void* data, unsigned int bytes) {
+    if (!m_recording.load(std::memory_order_relaxed)) {
+        // State Use Outside Record Prepares Next Record
+        if (isStateCommand(type)) {
+            this->executeCommand(type, data, false);
+            m_state_stale = true;
+        } else GPUReport::error("commands are not being recorded");
+        return;
+    }
+
+    // Ensure Arena Capacity, Records are 8-Byte Aligned
+    unsigned int size = sizeof(GLCommandRecord) + ((bytes + 7) & ~7u);
+    unsigned int needed = m_arena_bytes + size;
+    if (needed > m_arena_capacity) {
+        unsigned int capacity = (m_arena_capacity > 0) ? m_arena_capacity : 4096;
+        while (capacity < needed)
+            capacity <<= 1;
+        m_arena = (unsigned char*) realloc(m_arena, capacity);
+        m_arena_capacity = capacity;
+    }
+
+    // Append Packed Record
+    GLCommandRecord* record = (GLCommandRecord*) (m_arena + m_arena_bytes);
+    record->type = type;
+    record->bytes = size;
+    if (bytes > 0)
+        memcpy(record + 1, data, bytes);
+    m_arena_bytes = needed;
+}
+
+// -----------------------
+// GPU Commands: State Use
+// -----------------------
+
+bool GLCommands::applyCommand(GLCommandType type, void* data) {
+    GLCommandsState* current = &m_state;
+    switch (type) {
+        case GLCommandType::CMD_USE_PIPELINE: {
+            GLPipeline* pipeline = ((GLCommandObject*) data)->pipeline;
+            if (current->pipeline == pipeline) return false;
+            current->pipeline = pipeline;
+        } return true;
+
+        case GLCommandType::CMD_USE_VERTEX_ARRAY: {
+            GLVertexArray* vao = ((GLCommandObject*) data)->vertex_array;
+            if (current->vertex_array == vao) return false;
+            current->vertex_array = vao;
+        } return true;
+
+        case GLCommandType::CMD_USE_BLOCK_BINDING: {
+            GLBlockBinding* binding = (GLBlockBinding*) data;
+            unsigned int key = (binding->target << 16) | binding->index;
+            GLBlockBinding* found = current->block_bindings.get_key(key);
+            if (found && memcmp(found, binding, sizeof(GLBlockBinding)) == 0)
+                return false;
+            current->block_bindings.replace_key(key, *binding);
+        } return true;
+
+        case GLCommandType::CMD_USE_TEXTURE: {
+            GLTextureActive* active = (GLTextureActive*) data;
+            GLTextureActive* found = current->texture_actives.get_key(active->unit);
+            if (active->texture == nullptr) {
+                current->texture_actives.remove_key(active->unit);
+                return found != nullptr;
+            }
+
+            // Replace Texture Unit
+            if (found && found->texture == active->texture) return false;
+            current->texture_actives.replace_key(active->unit, *active);
+        } return true;
+
+        case GLCommandType::CMD_USE_TEXTURE_SAMPLER: {
+            GLCommandSampler* use = (GLCommandSampler*) data;
+            GLTextureSampler* found = current->texture_samplers.get_key(use->key);
+            if (use->binding.texture == nullptr) {
+                current->texture_samplers.remove_key(use->key);
+                return found != nullptr;
+            }
+
+            // Replace Texture Sampler
+            if (found && found->texture == use->binding.texture &&
+                found->sampler == use->binding.sampler) return false;
+            current->texture_samplers.replace_key(use->key, use->binding);
+        } return true;
+
+        case GLCommandType::CMD_USE_FRAMEBUFFER_DRAW: {
+            GLFrameBuffer* fbo = ((GLCommandObject*) data)->framebuffer;
+            if (current->framebuffer_draw == fbo) return false;
+            current->framebuffer_draw = fbo;
+        } return true;
+
+        case GLCommandType::CMD_USE_FRAMEBUFFER_READ: {
+            GLFrameBuffer* fbo = ((GLCommandObject*) data)->framebuffer;
+            if (current->framebuffer_read == fbo) return false;
+            current->framebuffer_read = fbo;
+        } return true;
+
+        // Not a State Command
+        default: return false;
+    }
+}
+
+static bool commandEffect(GLCommandType type, GLCommandsEffect &effect) {
+    switch (type) {
+        case GLCommandType::CMD_USE_PIPELINE:
+            effect = GLCommandsEffect::CMD_EFFECT_PIPELINE; return true;
+        case GLCommandType::CMD_USE_VERTEX_ARRAY:
+            effect = GLCommandsEffect::CMD_EFFECT_VERTEX_ARRAY; return true;
+        case GLCommandType::CMD_USE_BLOCK_BINDING:
+            effect = GLCommandsEffect::CMD_EFFECT_BLOCK_BINDING; return true;
+        case GLCommandType::CMD_USE_TEXTURE:
+            effect = GLCommandsEffect::CMD_EFFECT_TEXTURE_ACTIVE; return true;
+        case GLCommandType::CMD_USE_FRAMEBUFFER_DRAW:
+            effect = GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_DRAW; return true;
+        case GLCommandType::CMD_USE_FRAMEBUFFER_READ:
+            effect = GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_READ; return true;
+        // Samplers are Resolved at Each Draw
+        default: return false;
+    }
+}
+
+// ------------------------
+// GPU Commands: Replay Use
+// ------------------------
+
+void GLCommands::executeCommand(GLCommandType type, void* data, bool replay) {
+    if (isStateCommand(type)) {
+        GLCommandsEffect effect;
+        // Effects are Marked Only While Replaying
+        if (applyCommand(type, data) && replay && commandEffect(type, effect))
+            m_ctx_state->markCommandsEffect(effect);
+        return;
+    }
+
+    GLCommandsCounters* counters = &m_ctx_state->m_commands_counters;
+    switch (type) {
+        // OpenGL Command Rendering
+        case GLCommandType::CMD_DRAW_CLEAR: {
+            GLCommandExecute* execute = (GLCommandExecute*) data;
+            if (this->prepareEffects())
+                glClear(execute->bits);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ARRAYS: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawArrays(draw->mode, draw->offset, draw->count);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ARRAYS_INSTANCED: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawArraysInstanced(draw->mode, draw->offset, draw->count, draw->instances);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawElements(draw->mode, draw->count, draw->type, draw->indices);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawElementsBaseVertex(draw->mode, draw->count, draw->type,
+                    draw->indices, draw->base);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS_INSTANCED: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawElementsInstanced(draw->mode, draw->count, draw->type,
+                    draw->indices, draw->instances);
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS_BASE_VERTEX_INSTANCED: {
+            GLCommandDraw* draw = (GLCommandDraw*) data;
+            if (this->prepareShaders(true))
+                glDrawElementsInstancedBaseVertex(draw->mode, draw->count, draw->type,
+                    draw->indices, draw->instances, draw->base);
+        } break;
+
+        // OpenGL Command Rendering: Indirect
+        case GLCommandType::CMD_DRAW_ARRAYS_INDIRECT: {
+            GLCommandIndirect* draw = (GLCommandIndirect*) data;
+            m_ctx_state->hazardRead(draw->buffer, GL_COMMAND_BARRIER_BIT);
+            if (!this->prepareShaders(true)) break;
+            m_ctx_state->bindIndirectBuffer(GL_DRAW_INDIRECT_BUFFER, draw->buffer);
+            glDrawArraysIndirect(draw->mode, (void*) (long) draw->offset);
+            counters->draws_recorded++;
+            counters->draws_issued++;
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT: {
+            GLCommandIndirect* draw = (GLCommandIndirect*) data;
+            m_ctx_state->hazardRead(draw->buffer, GL_COMMAND_BARRIER_BIT);
+            if (!this->prepareShaders(true)) break;
+            m_ctx_state->bindIndirectBuffer(GL_DRAW_INDIRECT_BUFFER, draw->buffer);
+            glDrawElementsIndirect(draw->mode, draw->type, (void*) (long) draw->offset);
+            counters->draws_recorded++;
+            counters->draws_issued++;
+        } break;
+
+        case GLCommandType::CMD_DRAW_ELEMENTS_INDIRECT_COUNT: {
+            GLCommandIndirect* draw = (GLCommandIndirect*) data;
+            m_ctx_state->hazardRead(draw->buffer, GL_COMMAND_BARRIER_BIT);
+            m_ctx_state->hazardRead(draw->count, GL_COMMAND_BARRIER_BIT);
+            if (!this->prepareShaders(true)) break;
+            m_ctx_state->bindIndirectBuffer(GL_DRAW_INDIRECT_BUFFER, draw->buffer);
+            m_ctx_state->bindIndirectBuffer(GL_PARAMETER_BUFFER_ARB, draw->count);
+            glMultiDrawElementsIndirectCountARB(draw->mode, draw->type,
+                (void*) (long) draw->offset, draw->count_offset, draw->max_count, draw->stride);
+            counters->draws_recorded++;
+            counters->draws_issued++;
+        } break;
+
+        case GLCommandType::CMD_EXECUTE_COMPUTE:
+        case GLCommandType::CMD_EXECUTE_COMPUTE_SYNC: {
+            GLCommandExecute* execute = (GLCommandExecute*) data;
+            if (!this->prepareShaders(false)) break;
+            glDispatchCompute(execute->x, execute->y, execute->z);
+            // Wait Compute Writes, Merged with Next Barrier
+            m_ctx_state->requestBarrier(execute->bits);
+        } break;
+
+        case GLCommandType::CMD_EXECUTE_COMPUTE_INDIRECT: {
+            GLCommandIndirect* execute = (GLCommandIndirect*) data;
+            m_ctx_state->hazardRead(execute->buffer, GL_COMMAND_BARRIER_BIT);
+            if (!this->prepareShaders(false)) break;
+            m_ctx_state->bindIndirectBuffer(GL_DISPATCH_INDIRECT_BUFFER, execute->buffer);
+            glDispatchComputeIndirect(execute->offset);
+        } break;
+
+        case GLCommandType::CMD_MEMORY_BARRIER: {
+            GLCommandExecute* execute = (GLCommandExecute*) data;
+            // Explicit Barriers are Merged with Adjacent Barriers
+            m_ctx_state->requestBarrier(execute->bits);
+        } break;
+
+        // OpenGL Command Timer
+        case GLCommandType::CMD_TIMER_BEGIN:
+            m_ctx->m_timers.beginTimer(((GLCommandTimer*) data)->label);
+            break;
+        case GLCommandType::CMD_TIMER_END:
+            m_ctx->m_timers.endTimer();
+            break;
+
+        // OpenGL Command Query
+        case GLCommandType::CMD_QUERY_BEGIN:
+        case GLCommandType::CMD_QUERY_END:
+        case GLCommandType::CMD_CONDITIONAL_BEGIN:
+            this->executeQuery(type, ((GLCommandObject*) data)->query);
+            break;
+        case GLCommandType::CMD_CONDITIONAL_END:
+            this->executeQuery(type, nullptr);
+            break;
+
+        // OpenGL Command Fence
+        case GLCommandType::CMD_SYNC_FLUSH: glFlush(); break;
+        case GLCommandType::CMD_SYNC_FINISH: glFinish(); break;
+        case GLCommandType::CMD_SYNC_FENCE: {
+            GLFence* fence = ((GLCommandObject*) data)->fence;
+            if (fence->m_destroyed)
+                break;
+
+            // Restamp Fence when Replayed Again
+            if (fence->m_sync) glDeleteSync(fence->m_sync);
+            fence->m_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        } break;
+
+        // State Commands Handled Above
+        default: break;
+    }
+}
+
+void GLCommands::replayCommands() {
+    GLState* state = m_ctx_state;
+    if (state->m_commands_current != nullptr) {
+        GPUReport::error("other commands are being replayed");
+        return;
+    }
+
+    // Bundles Start from Empty Entry State
+    if (m_mode == GLCommandsMode::COMMANDS_BUNDLE) {
+        if (!m_bundle_valid) {
+            GPUReport::error("commands bundle is not valid");
+            return;
+        }
+
+        m_state = GLCommandsState();
+        state->checkCommandsEffects(m_state);
+    } else if (state->m_commands_cached != this || m_state_stale)
+        state->checkCommandsEffects(m_state);
+    m_state_stale = false;
+
+    // Diff State when Other Commands were Used
+    state->m_commands_current = this;
+    // Baked Binds Start from Resolved Entry State
+    if (m_mode == GLCommandsMode::COMMANDS_BUNDLE)
+        state->resolveCommandsEffects();
+
+    // Replay Packed Records
+    unsigned char* cursor = m_arena;
+    unsigned char* end = m_arena + m_arena_bytes;
+    while (cursor < end) {
+        GLCommandRecord* record = (GLCommandRecord*) cursor;
+        if (isDrawCommand(record->type)) {
+            cursor = this->coalesceDraws(cursor, end);
+            continue;
+        }
+
+        // Baked Binds Skip State Effects
+        if (isBakedCommand(record->type))
+            state->resolveBakedBind(record->type, record + 1);
+        else this->executeCommand(record->type, record + 1, true);
+        cursor += record->bytes;
+    }
+
+    // Keep Commands Cached for Next Replay
+    state->flushBarriers();
+    state->m_commands_current = nullptr;
+    state->m_commands_cached = this;
+}
+
+// ----------------------------
+// GPU Context: Commands Submit
+// ----------------------------
+
+void GLContext::submit(GPUCommands** list, int count) {
+    GPUTraceScope trace = makeCurrent(this);
+    for (int i = 0; i < count; i++) {
+        GLCommands* commands = static_cast<GLCommands*>(list[i]);
+        if (commands == nullptr || commands->m_mode == GLCommandsMode::COMMANDS_IMMEDIATE) {
+            GPUReport::error("commands are not deferred");
+            continue;
+        }
+
+        // Acquire Record Published by Recording Thread
+        if (commands->m_recording.load(std::memory_order_acquire)) {
+            GPUReport::error("commands are still being recorded");
+            continue;
+        }
+
+        // Replay Commands in Submit Order
+        commands->replayCommands();
+    }
+
+    // Drain Asynchronous Debug Messages
+    m_device->m_debug.drain();
+}
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include <nogpu_trace.h>
+#include "private/commands.h"
+#include "private/context.h"
+#include "private/timer.h"
+#include "private/glad.h"
+#include <cstdlib>
+
+void GLTimers::prepareFrame(GLTimerFrame* frame) {
+    // Unresolved Frame is Dropped when Reused
+    frame->scopes_count = 0;
+    frame->frame = m_frame;
+    frame->pending = false;
+    frame->active = true;
+
+    // Correlate GPU Timestamps with CPU Clock
+    GLint64 gpu = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpu);
+    frame->offset = (long long) GPUTrace::clock() - gpu;
+}
+
+void GLTimers::disposeTimers() {
+    for (int i = 0; i < GL_TIMER_FRAMES; i++) {
+        GLTimerFrame* frame = m_frames + i;
+        if (frame->queries != nullptr)
+            glDeleteQueries(frame->scopes_capacity * 2, frame->queries);
+        free(frame->queries);
+        free(frame->scopes);
+        *frame = {};
+    }
+
+    // Dealloc Resolved Table
+    free(m_results);
+    m_results = nullptr;
+    m_results_capacity = 0;
+    m_table = {};
+}
+
+// ---------------------------
+// OpenGL GPU Timer: Recording
+// ---------------------------
+
+void GLTimers::beginTimer(const char* label) {
+    GLTimerFrame* frame = m_frames + m_current;
+    if (!frame->active)
+        prepareFrame(frame);
+    if (m_stack_count == GL_TIMER_DEPTH) {
+        GPUReport::error("timer scopes are nested too deep");
+        return;
+    }
+
+    // Grow Scopes and Timestamp Query Pairs
+    if (frame->scopes_count == frame->scopes_capacity) {
+        int capacity0 = frame->scopes_capacity;
+        int capacity = (capacity0 > 0) ? capacity0 << 1 : 32;
+        frame->scopes = (GLTimerScope*) realloc(frame->scopes, capacity * sizeof(GLTimerScope));
+        frame->queries = (GLuint*) realloc(frame->queries, capacity * 2 * sizeof(GLuint));
+        glGenQueries((capacity - capacity0) * 2, frame->queries + capacity0 * 2);
+        frame->scopes_capacity = capacity;
+    }
+
+    // Stamp Scope Begin
+    int index = frame->scopes_count++;
+    GLTimerScope* scope = frame->scopes + index;
+    scope->label = label;
+    scope->depth = m_stack_count;
+    scope->parent = (m_stack_count > 0) ? m_stack[m_stack_count - 1] : -1;
+    scope->cpu_begin = GPUTrace::clock();
+    scope->cpu_end = scope->cpu_begin;
+    glQueryCounter(frame->queries[index * 2], GL_TIMESTAMP);
+    frame->last = frame->queries[index * 2];
+    m_stack[m_stack_count++] = index;
+}
+
+void GLTimers::endTimer() {
+    GLTimerFrame* frame = m_frames + m_current;
+    if (m_stack_count == 0) {
+        GPUReport::error("timer scope was not begun");
+        return;
+    }
+
+    // Stamp Scope End
+    int index = m_stack[--m_stack_count];
+    GLTimerScope* scope = frame->scopes + index;
+    glQueryCounter(frame->queries[index * 2 + 1], GL_TIMESTAMP);
+    frame->last = frame->queries[index * 2 + 1];
+    scope->cpu_end = GPUTrace::clock();
+}
+
+// --------------------------
+// OpenGL GPU Timer: Readback
+// --------------------------
+
+bool GLTimers::resolveFrame(GLTimerFrame* frame) {
+    GLint available = 0;
+    // Timestamps Complete in Issue Order
+    glGetQueryObjectiv(frame->last, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == 0)
+        return false;
+
+    // Ensure Resolved Table Capacity
+    int count = frame->scopes_count;
+    if (count > m_results_capacity) {
+        m_results = (GPUTimerScope*) realloc(m_results, count * sizeof(GPUTimerScope));
+        m_results_capacity = count;
+    }
+
+    for (int i = 0; i < count; i++) {
+        GLTimerScope* scope = frame->scopes + i;
+        GPUTimerScope* result = m_results + i;
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(frame->queries[i * 2], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame->queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+
+        // Fill Hierarchical Scope
+        result->label = scope->label;
+        result->depth = scope->depth;
+        result->parent = scope->parent;
+        result->gpu_ns = (end > begin) ? end - begin : 0;
+        result->cpu_ns = scope->cpu_end - scope->cpu_begin;
+        result->gpu_begin = begin + frame->offset;
+        result->cpu_begin = scope->cpu_begin;
+    }
+
+    // Replace Latest Resolved Table
+    m_table.scopes = m_results;
+    m_table.count = count;
+    m_table.frame = frame->frame;
+    frame->pending = false;
+    return true;
+}
+
+void GLTimers::advanceTimers() {
+    GLTimerFrame* frame = m_frames + m_current;
+    if (m_stack_count > 0) {
+        GPUReport::warning("timer scopes were left open");
+        while (m_stack_count > 0)
+            endTimer();
+    }
+
+    // Close Current Frame
+    frame->pending = frame->active && frame->scopes_count > 0;
+    frame->active = false;
+    m_current = (m_current + 1) % GL_TIMER_FRAMES;
+    m_frame++;
+
+    // Resolve Oldest Frames without Stalling
+    for (int i = 0; i < GL_TIMER_FRAMES; i++) {
+        GLTimerFrame* check = m_frames + (m_current + i) % GL_TIMER_FRAMES;
+        if (check->pending && !resolveFrame(check))
+            break;
+    }
+}
+
+// -------------------------
+// GPU Commands: Timer Scope
+// -------------------------
+
+void GLCommands::beginTimer(const char* label) {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    GLCommandTimer timer = {label};
+    this->recordCommand(GLCommandType::CMD_TIMER_BEGIN, &timer, sizeof(timer));
+}
+
+void GLCommands::endTimer() {
+    GPUTraceScope trace = m_ctx->makeRecord(this);
+    this->recordCommand(GLCommandType::CMD_TIMER_END, nullptr, 0);
+}
+
+GPUTimerTable GLContext::getTimers() {
+    GPUTraceScope trace = makeCurrent(this);
+    return m_timers.getTable();
+}
@@ -8,6 +8,7 @@ GLenum toValue(GPUBlockBinding type) {
         case GPUBlockBinding::BLOCK_BUFFER_OBJECT:
             return GL_UNIFORM_BUFFER;
         case GPUBlockBinding::BLOCK_SHADER_STORAGE:
+        case GPUBlockBinding::BLOCK_SHADER_STORAGE_READONLY:
             return GL_SHADER_STORAGE_BUFFER;
         case GPUBlockBinding::BLOCK_ATOMIC_COUNTER:
             return GL_ATOMIC_COUNTER_BUFFER;
@@ -109,3 +110,40 @@ GLbitfield toValue(GPUMemoryBarrier flags) {
     // Return Barrier Flags
     return result;
 }
+
+// -------------------------
+// GPU Context: Query Objects
+// -------------------------
+
+GLenum toValue(GPUQueryType type) {
+    switch (type) {
+        case GPUQueryType::QUERY_OCCLUSION:
+            return GL_ANY_SAMPLES_PASSED;
+        case GPUQueryType::QUERY_PRIMITIVES_GENERATED:
+            return GL_PRIMITIVES_GENERATED;
+        // Pipeline Statistics
+        case GPUQueryType::QUERY_VERTICES_SUBMITTED:
+            return GL_VERTICES_SUBMITTED_ARB;
+        case GPUQueryType::QUERY_PRIMITIVES_SUBMITTED:
+            return GL_PRIMITIVES_SUBMITTED_ARB;
+        case GPUQueryType::QUERY_VERTEX_SHADER_INVOCATIONS:
+            return GL_VERTEX_SHADER_INVOCATIONS_ARB;
+        case GPUQueryType::QUERY_TESS_CONTROL_PATCHES:
+            return GL_TESS_CONTROL_SHADER_PATCHES_ARB;
+        case GPUQueryType::QUERY_TESS_EVALUATION_INVOCATIONS:
+            return GL_TESS_EVALUATION_SHADER_INVOCATIONS_ARB;
+        case GPUQueryType::QUERY_GEOMETRY_PRIMITIVES_EMITTED:
+            return GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED_ARB;
+        case GPUQueryType::QUERY_FRAGMENT_SHADER_INVOCATIONS:
+            return GL_FRAGMENT_SHADER_INVOCATIONS_ARB;
+        case GPUQueryType::QUERY_COMPUTE_SHADER_INVOCATIONS:
+            return GL_COMPUTE_SHADER_INVOCATIONS_ARB;
+        case GPUQueryType::QUERY_CLIPPING_INPUT_PRIMITIVES:
+            return GL_CLIPPING_INPUT_PRIMITIVES_ARB;
+        case GPUQueryType::QUERY_CLIPPING_OUTPUT_PRIMITIVES:
+            return GL_CLIPPING_OUTPUT_PRIMITIVES_ARB;
+    }
+
+    // Unreachable Value
+    return GL_INVALID_ENUM;
+}
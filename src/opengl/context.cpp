@@ -2,6 +2,7 @@
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
 #include "nogpu_private.h"
 #include "private/buffer.h"
+#include "private/commands.h"
 #include "private/context.h"
 #include "private/texture.h"
 #include "private/compressed.h"
@@ -99,24 +100,49 @@ GPUPipeline* GLContext::createPipeline() {
 }
 
 GPUCommands* GLContext::createCommands() {
-    return nullptr;
+    return new GLCommands(this, GLCommandsMode::COMMANDS_IMMEDIATE);
+}
+
+GPUCommands* GLContext::createCommandsDeferred() {
+    return new GLCommands(this, GLCommandsMode::COMMANDS_DEFERRED);
+}
+
+GPUCommands* GLContext::createCommandsBundle() {
+    return new GLCommands(this, GLCommandsMode::COMMANDS_BUNDLE);
+}
+
+GPUDrawQueue* GLContext::createDrawQueue() {
+    return new GLDrawQueue(this);
+}
+
+GPUFenceQueue* GLContext::createFenceQueue() {
+    return new GLFenceQueue(this);
 }
 
 // -------------------------
 // GPU Context: Make Current
 // -------------------------
 
-void GLContext::makeCurrent(void* object) {
+GPUTraceScope GLContext::makeCurrent(void* object, const char* name) {
+    GPUTraceScope trace(object, name);
     GPUReport::setObject(object);
     m_driver->makeCurrent(this);
+    return trace;
 }
 
-void GLContext::makeCurrentTexture(void* object) {
+GPUTraceScope GLContext::makeCurrentTexture(void* object, const char* name) {
+    GPUTraceScope trace(object, name);
     GPUReport::setObject(object);
     m_driver->makeCurrent(this);
     // Set Active Texture to Stoled Texture Unit
     GLState *state = &m_device->m_state;
     glActiveTexture(state->m_stole_texture);
+    return trace;
+}
+
+GPUTraceScope GLContext::makeRecord(void* object, const char* name) {
+    // Recording Avoids Driver and Report State
+    return GPUTraceScope(object, name);
 }
 
 // -------------------------
@@ -126,3 +152,7 @@ void GLContext::makeCurrentTexture(void* object) {
 GLState* GLContext::manipulateState() {
     return &m_device->m_state;
 }
+
+GPUNameTable* GLContext::manipulateNames() {
+    return &m_device->m_names;
+}
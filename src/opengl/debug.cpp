@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include <nogpu_trace.h>
+#include "private/debug.h"
+#include <cstdlib>
+#include <cstring>
+
+GLDebugMessages::GLDebugMessages() {
+    m_interval = 1000000000ull;
+    m_queue_count = 0;
+    m_queue_dropped = 0;
+}
+
+GLDebugMessages::~GLDebugMessages() {
+    for (int i = 0; i < m_queue_count; i++)
+        free(m_queue[i].message);
+
+    for (GLDebugEntry* entry : m_entries) {
+        while (entry != nullptr) {
+            GLDebugEntry* next = entry->next;
+            free(entry->message);
+            delete entry;
+            entry = next;
+        }
+    }
+}
+
+void GLDebugMessages::setInterval(int ms) {
+    m_interval = (ms > 0) ? (unsigned long long) ms * 1000000ull : 0;
+}
+
+// ---------------------------
+// OpenGL Debug Message Lookup
+// ---------------------------
+
+static unsigned int debugKey(GLenum source, GLenum type, GLuint id) {
+    unsigned int key = id;
+    key ^= (source & 0xFF) << 24;
+    key ^= (type & 0xFF) << 16;
+    return key;
+}
+
+GLDebugMessages::GLDebugEntry* GLDebugMessages::lookup(GLenum source, GLenum type, GLuint id) {
+    unsigned int key = debugKey(source, type, id);
+    GLDebugEntry** found = m_entries.get_key(key);
+    GLDebugEntry* head = (found) ? *found : nullptr;
+    // Find Entry on Colliding Keys
+    for (GLDebugEntry* entry = head; entry != nullptr; entry = entry->next)
+        if (entry->source == source && entry->type == type && entry->id == id)
+            return entry;
+
+    // Create New Entry
+    GLDebugEntry* entry = new GLDebugEntry();
+    entry->source = source;
+    entry->type = type;
+    entry->id = id;
+    entry->next = head;
+    m_entries.replace_key(key, entry);
+    return entry;
+}
+
+// ---------------------------
+// OpenGL Debug Message Report
+// ---------------------------
+
+static void debugEmit(GLenum type, GLuint id, unsigned int repeats, const char* message) {
+    void (*emit)(const char* format, ...) = nullptr;
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR_ARB:
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR_ARB:
+            emit = GPUReport::error;
+            break;
+
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR_ARB:
+        case GL_DEBUG_TYPE_PORTABILITY_ARB:
+        case GL_DEBUG_TYPE_PERFORMANCE_ARB:
+            emit = GPUReport::warning;
+            break;
+
+        case GL_DEBUG_TYPE_OTHER_ARB:
+            emit = GPUReport::info;
+            break;
+
+        // Not Relevant Messages
+        default: return;
+    }
+
+    // Report Message or Summary
+    if (repeats > 0)
+        emit("0x%x: [repeated %u times] %s", id, repeats, message);
+    else emit("0x%x: %s", id, message);
+}
+
+void GLDebugMessages::report(GLenum source, GLenum type, GLuint id, const char* message) {
+    GLDebugEntry* entry = this->lookup(source, type, id);
+    bool error = type == GL_DEBUG_TYPE_ERROR_ARB ||
+        type == GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR_ARB;
+    // Emit First Occurrence and Errors
+    entry->count++;
+    if (entry->count == 1 || error) {
+        entry->summary = GPUTrace::clock();
+        debugEmit(type, id, 0, message);
+        // Keep Message for Pending Summary
+        if (entry->message == nullptr)
+            entry->message = strdup(message);
+        return;
+    }
+
+    // Emit Periodic Summary
+    entry->suppressed++;
+    entry->pending++;
+    unsigned long long now = GPUTrace::clock();
+    if (now - entry->summary >= m_interval) {
+        debugEmit(type, id, entry->pending, message);
+        entry->summary = now;
+        entry->pending = 0;
+    }
+}
+
+void GLDebugMessages::flush() {
+    unsigned long long now = GPUTrace::clock();
+    // Emit Summaries of Messages that Stopped Repeating
+    for (GLDebugEntry* entry : m_entries) {
+        for (; entry != nullptr; entry = entry->next) {
+            if (entry->pending == 0 || now - entry->summary < m_interval)
+                continue;
+
+            debugEmit(entry->type, entry->id, entry->pending, entry->message);
+            entry->summary = now;
+            entry->pending = 0;
+        }
+    }
+}
+
+int GLDebugMessages::stats(GPUDebugStats* stats, int capacity) {
+    int count = 0;
+    for (GLDebugEntry* entry : m_entries) {
+        for (; entry != nullptr; entry = entry->next) {
+            if (stats != nullptr && count < capacity) {
+                GPUDebugStats* stat = stats + count;
+                stat->source = entry->source;
+                stat->type = entry->type;
+                stat->id = entry->id;
+                stat->count = entry->count;
+                stat->suppressed = entry->suppressed;
+            }
+
+            // Next Entry
+            count++;
+        }
+    }
+
+    // Return Entries Count
+    return count;
+}
+
+// ---------------------------------
+// OpenGL Debug Message Queue: Async
+// ---------------------------------
+
+void GLDebugMessages::queue(GLenum source, GLenum type, GLuint id, const char* message, int length) {
+    if (length < 0)
+        length = (int) strlen(message);
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    const int capacity = sizeof(m_queue) / sizeof(GLDebugQueued);
+    if (m_queue_count >= capacity) {
+        m_queue_dropped++;
+        return;
+    }
+
+    // Copy Message to Queue
+    GLDebugQueued* queued = m_queue + m_queue_count;
+    queued->source = source;
+    queued->type = type;
+    queued->id = id;
+    queued->message = (char*) malloc(length + 1);
+    memcpy(queued->message, message, length);
+    queued->message[length] = '\0';
+    m_queue_count++;
+}
+
+void GLDebugMessages::drain() {
+    GLDebugQueued pending[sizeof(m_queue) / sizeof(GLDebugQueued)];
+    unsigned int dropped = 0;
+    int count = 0;
+
+    // Take Queued Messages
+    m_queue_mutex.lock();
+    count = m_queue_count;
+    dropped = m_queue_dropped;
+    memcpy(pending, m_queue, sizeof(GLDebugQueued) * count);
+    m_queue_count = 0;
+    m_queue_dropped = 0;
+    m_queue_mutex.unlock();
+
+    // Report Queued Messages
+    for (int i = 0; i < count; i++) {
+        GLDebugQueued* queued = pending + i;
+        this->report(queued->source, queued->type, queued->id, queued->message);
+        free(queued->message);
+    }
+
+    if (dropped > 0)
+        GPUReport::warning("[opengl] dropped %u driver debug messages", dropped);
+    // Report Pending Summaries
+    this->flush();
+}
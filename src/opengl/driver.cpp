@@ -25,6 +25,14 @@ unsigned int GLDriver::initializeGL(void* getProcAddress) {
         features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_COMPUTE);
     if (GLAD_GL_ARB_debug_output) // Debug Feature
         features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_DEBUG);
+    if (GLAD_GL_ARB_draw_indirect) // Indirect Draw Feature
+        features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_DRAW_INDIRECT);
+    if (GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_indirect_parameters)
+        features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_DRAW_INDIRECT_COUNT);
+    if (GLAD_GL_ARB_pipeline_statistics_query) // Pipeline Statistics Feature
+        features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_QUERY_STATISTICS);
+    if (GLAD_GL_ARB_buffer_storage) // Persistent Buffer Feature
+        features |= driver_feature_flag(GPUDriverFeature::DRIVER_FEATURE_BUFFER_STORAGE);
     if (GLAD_GL_ARB_texture_buffer_range) // Texture Buffer Feature
         features |= driver_feature_flag(GPUDriverFeature::DRIVER_TEXTURE_BUFFER);
     if (GLAD_GL_ARB_texture_cube_map_array) // Texture Cubemap Array Feature
@@ -70,34 +78,36 @@ static void GLAD_API_PTR nogpu_debugCallback(
     const char *message, 
     const void *user)
 {
-    switch (type) {
-        case GL_DEBUG_TYPE_ERROR_ARB:
-        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR_ARB:
-            GPUReport::error("0x%x: %s", id, message);
-            break;
-
-        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR_ARB:
-        case GL_DEBUG_TYPE_PORTABILITY_ARB:
-        case GL_DEBUG_TYPE_PERFORMANCE_ARB:
-            GPUReport::warning("0x%x: %s", id, message);
-            break;
-
-        case GL_DEBUG_TYPE_OTHER_ARB:
-            GPUReport::info("0x%x: %s", id, message);
-            break;
-
-        // Not Relevant Messages
-        default: break;
-    }
+    GLDebugMessages* messages = (GLDebugMessages*) user;
+    messages->report(source, type, id, message);
 }
 
-void GLDevice::prepareContextDebug(GPUDriverMode mode) {
+static void GLAD_API_PTR nogpu_debugCallbackAsync(
+    GLenum source, 
+    GLenum type, 
+    unsigned int id, 
+    GLenum severity, 
+    GLsizei length, 
+    const char *message, 
+    const void *user)
+{
+    GLDebugMessages* messages = (GLDebugMessages*) user;
+    messages->queue(source, type, id, message, length);
+}
+
+void GLDevice::prepareContextDebug(GPUDriverMode mode, bool sync) {
     switch (mode) {
         case GPUDriverMode::DRIVER_MODE_REPORT:
         case GPUDriverMode::DRIVER_MODE_LOGGER:
         case GPUDriverMode::DRIVER_MODE_DEBUG:
-            glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB); 
-            glDebugMessageCallbackARB(nogpu_debugCallback, nullptr);
+            if (sync == false && mode != GPUDriverMode::DRIVER_MODE_DEBUG) {
+                glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+                glDebugMessageCallbackARB(nogpu_debugCallbackAsync, &m_debug);
+            } else {
+                glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+                glDebugMessageCallbackARB(nogpu_debugCallback, &m_debug);
+            }
+
             glDebugMessageControlARB( // Enable All Messages
                 GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE,
                 0, nullptr, GL_TRUE);
@@ -107,6 +117,31 @@ void GLDevice::prepareContextDebug(GPUDriverMode mode) {
     }
 }
 
+int GLDevice::getDebugStats(GPUDebugStats* stats, int capacity) {
+    return m_debug.stats(stats, capacity);
+}
+
+void GLDevice::setDebugInterval(int ms) {
+    m_debug.setInterval(ms);
+}
+
+GPUStateCounters GLDevice::getStateCounters() {
+    GPUStateCounters result;
+    result.binds = m_state.m_commands_counters.binds;
+    result.elided = m_state.m_commands_counters.elided;
+    result.texture_hits = m_state.m_commands_counters.texture_hits;
+    result.texture_misses = m_state.m_commands_counters.texture_misses;
+    result.draws_recorded = m_state.m_commands_counters.draws_recorded;
+    result.draws_issued = m_state.m_commands_counters.draws_issued;
+    result.barriers = m_state.m_commands_counters.barriers;
+    // Hashmap Counters are Shared by All Maps
+    GPUHashmapCounters heap = GPUHashmapOpaque::counters();
+    result.hashmap_allocs = heap.allocs;
+    result.hashmap_reallocs = heap.reallocs;
+    result.hashmap_frees = heap.frees;
+    return result;
+}
+
 // --------------------
 // OpenGL Texture Stole
 // --------------------
@@ -125,6 +160,8 @@ void GLDevice::prepareContextState() {
     m_state.m_stole_texture = stole;
     m_state.m_pipeline_effects = 0x1FFF;
     m_state.m_commands_effects = 0x3F;
+    m_state.m_commands_clobber = 0x3F;
+    m_state.prepareTextureUnits(stole - GL_TEXTURE0);
 
     // Disable all Capabilites by Default
     glDisable(GL_BLEND); /* CAPABILITY_BLENDING */
@@ -209,6 +209,10 @@ bool GLDriver::impl__getVerticalSync() {
     return m_vsync;
 }
 
+void GLDriver::impl__setDebugSynchronous(bool value) {
+    m_debug_sync = value;
+}
+
 bool GLDriver::impl__getDriverFeature(GPUDriverFeature feature) {
     return (m_features & driver_feature_flag(feature)) != 0;
 }
@@ -311,6 +315,8 @@ bool GLDevice::destroy() {
     }
 
     // Return Device Destroyed
+    m_state.disposePipelineTransitions();
+    m_state.disposeTextureUnits();
     m_driver->disposeDevice(this);
     delete this;
     return true;
@@ -409,7 +415,7 @@ DEBUG_CONTEXT: {
 
     // Initialize: EGL Debug Context
     eglMakeCurrent(egl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl->context);
-    this->prepareContextDebug(m_driver->m_mode);
+    this->prepareContextDebug(m_driver->m_mode, m_driver->m_debug_sync);
     this->prepareContextState();
     eglMakeCurrent(egl_dpy0, egl_draw0, egl_read0, egl_ctx0);
 }
@@ -605,12 +611,20 @@ void GLDriver::makeCurrent(GLContext* ctx) {
 
 void GLContext::surfaceSwap() {
     // XXX: THIS IS A DUMMY :XXX
-    makeCurrent(this);
+    GPUTraceScope trace = makeCurrent(this);
     glClearColor(0.2, 0.2, 0.3, 0.5);
     glClear(GL_COLOR_BUFFER_BIT);
     // Swap Context Buffer
     LinuxEGLContext *gtx = &m_egl_context;
     eglSwapBuffers(gtx->display, gtx->surface);
+    // Fence Stream Regions and Fire Completed Fence Callbacks
+    this->advanceStreamBuffers();
+    this->pollFenceQueues();
+    // Retire Signaled Timeline Fences without Waiting
+    this->retireTimeline(m_timeline_completed);
+    m_timers.advanceTimers();
+    // Drain Asynchronous Debug Messages
+    m_device->m_debug.drain();
 }
 
 void GLContext::surfaceResize(int w, int h) {
@@ -638,6 +652,8 @@ bool GLContext::surfaceRGBA() {
 void GLContext::destroy() {
     m_driver->makeCurrent(this);
     m_device->m_ctx_cache.remove(this);
+    this->disposeFences();
+    m_timers.disposeTimers();
 
     // Destroy EGL Surface and Remove Current
     LinuxEGLContext *gtx = &m_egl_context;
@@ -8,7 +8,7 @@
 #include <string.h>
 
 GLFrameBuffer::GLFrameBuffer(GLContext* ctx) {
-    ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = ctx->makeCurrentTexture(this);
     glGenFramebuffers(1, &m_fbo);
     // Initialize Current List
     m_colors_index.indexes = &m_color_index;
@@ -19,9 +19,11 @@ GLFrameBuffer::GLFrameBuffer(GLContext* ctx) {
 }
 
 void GLFrameBuffer::destroy() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Destroy FrameBuffer
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    m_ctx->manipulateState()->clobberFrameBuffers();
+    m_ctx->manipulateState()->invalidateBundles(this);
     glDeleteFramebuffers(1, &m_fbo);
     // Destroy Color Indexes
     if (m_colors_index.capacity > 1)
@@ -78,7 +80,7 @@ void GLFrameBuffer::updateIndexes() {
 // ------------------------------
 
 void GLFrameBuffer::attachColor(GPURenderBuffer *target, int index) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     if (index < 0) index = 0;
     if (target == nullptr) {
         GPUReport::error("invalid renderbuffer");
@@ -104,7 +106,7 @@ void GLFrameBuffer::attachColor(GPURenderBuffer *target, int index) {
 
 void GLFrameBuffer::attachDepth(GPURenderBuffer *target) {
     auto buffer = dynamic_cast<GLRenderBuffer*>(target);
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Check Attachment Buffer
     if (buffer == nullptr) {
@@ -124,7 +126,7 @@ void GLFrameBuffer::attachDepth(GPURenderBuffer *target) {
 
 void GLFrameBuffer::attachStencil(GPURenderBuffer *target) {
     auto buffer = dynamic_cast<GLRenderBuffer*>(target);
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Check Attachment Buffer
     if (buffer == nullptr) {
@@ -147,7 +149,7 @@ void GLFrameBuffer::attachStencil(GPURenderBuffer *target) {
 // ------------------------------
 
 void GLFrameBuffer::detachColor(int index) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     if (index < 0) index = 0;
     // Update Render Link Pointer
     if (m_colors.remove_key(index))
@@ -167,7 +169,7 @@ void GLFrameBuffer::detachStencil() {
 // ------------------------------
 
 void GLFrameBuffer::setColorIndex(int index) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Set One Color Index
     this->reserveIndexes(1);
     this->m_colors_index.indexes[0] = index;
@@ -175,7 +177,7 @@ void GLFrameBuffer::setColorIndex(int index) {
 }
 
 void GLFrameBuffer::setColorIndexes(int *list, int count) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Set Multiple Color Index
     this->reserveIndexes(count);
     void* indexes = m_colors_index.indexes;
@@ -188,7 +190,7 @@ void GLFrameBuffer::setColorIndexes(int *list, int count) {
 // --------------------------------
 
 void GLFrameBuffer::setColorSlice(int index, int layer, int level) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Update Color Indexes
     GLRenderLink* result = m_colors.get_key(index);
     if (result != nullptr) {
@@ -201,7 +203,7 @@ void GLFrameBuffer::setColorSlice(int index, int layer, int level) {
 }
 
 void GLFrameBuffer::setDepthSlice(int layer, int level) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     if (m_depth.target == nullptr) {
         GPUReport::warning("depth attachment not found");
         return;
@@ -214,7 +216,7 @@ void GLFrameBuffer::setDepthSlice(int layer, int level) {
 }
 
 void GLFrameBuffer::setStencilSlice(int layer, int level) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     if (m_stencil.target == nullptr) {
         GPUReport::warning("stencil attachment not found");
         return;
@@ -253,7 +255,7 @@ void GLFrameBuffer::setCubemapStencilSlice(GPUTextureCubemapSide side, int layer
 // ----------------------
 
 int GLFrameBuffer::getColorIndex() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Return Current Color Index
     if (m_color == nullptr)
@@ -262,7 +264,7 @@ int GLFrameBuffer::getColorIndex() {
 }
 
 int GLFrameBuffer::getColorIndexes(int *list, int capacity) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GLRenderIndexes* list0 = &m_colors_index;
 
     // Clamp Count to Capacity
@@ -282,7 +284,7 @@ int GLFrameBuffer::getColorIndexes(int *list, int capacity) {
 }
 
 GPURenderBuffer* GLFrameBuffer::getColorCurrent() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GPURenderBuffer* result = nullptr;
     GLRenderLink* color = m_color;
 
@@ -293,7 +295,7 @@ GPURenderBuffer* GLFrameBuffer::getColorCurrent() {
 }
 
 GPURenderBuffer* GLFrameBuffer::getColor(int index) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GPURenderBuffer* result = nullptr;
     GLRenderLink* color = m_colors.get_key(index);
 
@@ -304,12 +306,12 @@ GPURenderBuffer* GLFrameBuffer::getColor(int index) {
 }
 
 GPURenderBuffer* GLFrameBuffer::getDepth() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     return m_depth.target;
 }
 
 GPURenderBuffer* GLFrameBuffer::getStencil() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     return m_stencil.target;
 }
 
@@ -318,7 +320,7 @@ GPURenderBuffer* GLFrameBuffer::getStencil() {
 // -----------------------------
 
 GPUFrameBufferSlice GLFrameBuffer::getColorSlice(int index) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GPURenderBuffer* result = nullptr;
     GLRenderLink* color = m_colors.get_key(index);
 
@@ -330,7 +332,7 @@ GPUFrameBufferSlice GLFrameBuffer::getColorSlice(int index) {
 }
 
 GPUFrameBufferSlice GLFrameBuffer::getDepthSlice() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Return Depth Slice
     if (m_depth.target == nullptr)
         GPUReport::warning("depth attachment not found");
@@ -338,7 +340,7 @@ GPUFrameBufferSlice GLFrameBuffer::getDepthSlice() {
 }
 
 GPUFrameBufferSlice GLFrameBuffer::getStencilSlice() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Return Stencil Slice
     if (m_stencil.target == nullptr)
         GPUReport::warning("stencil attachment not found");
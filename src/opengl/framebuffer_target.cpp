@@ -6,7 +6,7 @@
 #include "private/glad.h"
 
 GLRenderBuffer::GLRenderBuffer(GLContext* ctx, GPUTexturePixelType type) {
-    ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = ctx->makeCurrentTexture(this);
     if (type == GPUTexturePixelType::TEXTURE_PIXEL_COMPRESSED) {
         GPUReport::error("compressed framebuffer texture type is not supported");
         delete this;
@@ -20,7 +20,7 @@ GLRenderBuffer::GLRenderBuffer(GLContext* ctx, GPUTexturePixelType type) {
 }
 
 void GLRenderBuffer::destroy() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Destroy Object
     this->destroyInternal();
@@ -135,7 +135,7 @@ void GLRenderBuffer::updateExternal() {
 }
 
 void GLRenderBuffer::useTexture(GPUTexture* texture) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GLTexture* tex0 = dynamic_cast<GLTexture*>(texture);
     if (tex0->m_pixel_type != m_pixel_type) {
         GPUReport::error("mismatch texture pixel type for framebuffer");
@@ -154,13 +154,13 @@ void GLRenderBuffer::useTexture(GPUTexture* texture) {
 // -------------------------------------
 
 GPUTexturePixelType GLRenderBuffer::getPixelType() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     this->updateExternal();
     return m_pixel_type;
 }
 
 GPURenderBufferMode GLRenderBuffer::getMode() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     this->updateExternal();
     return m_mode;
 }
@@ -170,7 +170,7 @@ GPURenderBufferMode GLRenderBuffer::getMode() {
 // ------------------------------
 
 GPUTexture* GLRenderBuffer::getTexture() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     switch (m_mode) {
         case GPURenderBufferMode::RENDERBUFFER_UNDEFINED:
@@ -186,7 +186,7 @@ GPUTexture* GLRenderBuffer::getTexture() {
 }
 
 GPUTextureSize GLRenderBuffer::getSize() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GPUTextureSize size = {0, 0};
 
     switch (m_mode) {
@@ -218,7 +218,7 @@ int GLRenderBuffer::getHeight() {
 }
 
 int GLRenderBuffer::getDepth() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     switch (m_mode) {
         case GPURenderBufferMode::RENDERBUFFER_UNDEFINED:
@@ -237,7 +237,7 @@ int GLRenderBuffer::getLayers() {
 }
 
 int GLRenderBuffer::getLevels() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Return Texture Levels
     switch (m_mode) {
@@ -253,7 +253,7 @@ int GLRenderBuffer::getLevels() {
 }
 
 int GLRenderBuffer::getSamples() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     if (m_mode == GPURenderBufferMode::RENDERBUFFER_UNDEFINED)
         GPUReport::warning("cannot get samples of undefined renderbuffer");
 
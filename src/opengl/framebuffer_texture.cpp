@@ -6,7 +6,7 @@
 #include "private/glad.h"
 
 void GLRenderBuffer::createOffscreen(int w, int h, int samples) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     this->destroyInternal();
 
     glGenRenderbuffers(1, &m_tex);
@@ -27,7 +27,7 @@ void GLRenderBuffer::createOffscreen(int w, int h, int samples) {
 // ----------------------------------------
 
 void GLRenderBuffer::createTexture2D(int w, int h, int levels, int samples) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     levels = levels_power_of_two(w, h, levels);
     samples = (samples > 0) ? next_power_of_two(samples) : 1;
     // Check Texture Recreate
@@ -76,7 +76,7 @@ void GLRenderBuffer::createTexture2D(int w, int h, int levels, int samples) {
 }
 
 void GLRenderBuffer::createTextureArray(int w, int h, int layers, int levels, int samples) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     levels = levels_power_of_two(w, h, levels);
     samples = (samples > 0) ? next_power_of_two(samples) : 1;
     // Check Texture Recreate
@@ -126,7 +126,7 @@ void GLRenderBuffer::createTextureArray(int w, int h, int layers, int levels, in
 // ----------------------------------------
 
 void GLRenderBuffer::createTexture3D(int w, int h, int layers, int levels) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     levels = levels_power_of_two(w, h, levels);
     this->prepareInternal();
 
@@ -232,8 +232,9 @@ void GLFrameBuffer::updateAttachment(GLenum attachment, GLRenderLink* link) {
 }
 
 GPUFrameBufferStatus GLFrameBuffer::checkAttachments() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
 
     // Check Color Attachments
     GLRenderIndexes* list = &m_colors_index;
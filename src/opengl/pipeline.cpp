@@ -5,19 +5,34 @@
 #include "private/program.h"
 
 GLPipeline::GLPipeline(GLContext* ctx) {
-    ctx->makeCurrent(this);
+    GPUTraceScope trace = ctx->makeCurrent(this);
     m_state = GLPipelineState{};
+    m_object = nullptr;
     m_ctx_state = &ctx->m_device->m_state;
     m_ctx = ctx;
 }
 
 void GLPipeline::markEffect(GLPipelineEffect effect) {
+    if (m_object != nullptr) {
+        m_ctx_state->releasePipelineState(m_object);
+        m_object = nullptr;
+    }
+
+    // Mark Effect when Pipeline is Current
     if (m_ctx_state->m_pipeline_current == this)
         m_ctx_state->markPipelineEffect(effect);
 }
 
 void GLPipeline::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
+    GLState* state = m_ctx->manipulateState();
+    if (state->m_pipeline_current == this)
+        state->m_pipeline_current = nullptr;
+    if (m_object != nullptr)
+        state->releasePipelineState(m_object);
+    state->invalidateBundles(this);
+
+    // Dealloc Object
     delete this;
 }
 
@@ -26,20 +41,20 @@ void GLPipeline::destroy() {
 // ---------------------------
 
 bool GLPipeline::checkCapability(GPUPipelineCapability cap) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Check Activated Capability
     unsigned int flag = (1 << static_cast<unsigned int>(cap));
     return (m_state.capabilities & flag) != 0;
 }
 
 void GLPipeline::enableCapability(GPUPipelineCapability cap) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CAPABILITIES);
     m_state.capabilities |= 1 << static_cast<unsigned int>(cap);
 }
 
 void GLPipeline::disableCapability(GPUPipelineCapability cap) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CAPABILITIES);
     m_state.capabilities &= ~(1 << static_cast<unsigned int>(cap));
 }
@@ -49,32 +64,32 @@ void GLPipeline::disableCapability(GPUPipelineCapability cap) {
 // --------------------------
 
 void GLPipeline::setProgram(GPUProgram *program) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_PROGRAM);
     GLProgram* pro = static_cast<GLProgram*>(program);
     m_state.program = pro;
 }
 
 void GLPipeline::setBlending(GPUPipelineBlending blending) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_BLENDING);
     m_state.blending = blending;
 }
 
 void GLPipeline::setCulling(GPUPipelineFace face) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CULLING);
     m_state.culling = face;
 }
 
 void GLPipeline::setDepth(GPUPipelineDepth depth) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_DEPTH);
     m_state.depth = depth;
 }
 
 void GLPipeline::setStencil(GPUPipelineStencil stencil) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_STENCIL);
     m_state.stencil = stencil;
 }
@@ -84,43 +99,43 @@ void GLPipeline::setStencil(GPUPipelineStencil stencil) {
 // ----------------------------
 
 void GLPipeline::setClearDepth(float depth) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CLEAR_DEPTH);
     m_state.clear_depth = depth;
 }
 
 void GLPipeline::setClearStencil(int mask) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CLEAR_STENCIL);
     m_state.clear_stencil = mask;
 }
 
 void GLPipeline::setClearColor(GPUColor color) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_CLEAR_COLOR);
     m_state.clear_color = color;
 }
 
 void GLPipeline::setColorMask(GPUColorMask mask) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_COLOR_MASK);
     m_state.color_mask = mask;
 }
 
 void GLPipeline::setViewport(GPURectangle rect) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_VIEWPORT);
     m_state.viewport = rect;
 }
 
 void GLPipeline::setScissor(GPURectangle rect) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_SCISSOR);
     m_state.scissor = rect;
 }
 
 void GLPipeline::setLineWidth(float width) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     markEffect(GLPipelineEffect::PIPELINE_EFFECT_LINE_WIDTH);
     m_state.line_width = width;
 }
@@ -130,27 +145,27 @@ void GLPipeline::setLineWidth(float width) {
 // ----------------------------
 
 GPUProgram* GLPipeline::getProgram() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.program;
 }
 
 GPUPipelineBlending GLPipeline::getBlending() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.blending;
 }
 
 GPUPipelineFace GLPipeline::getCulling() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.culling;
 }
 
 GPUPipelineDepth GLPipeline::getDepth() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.depth;
 }
 
 GPUPipelineStencil GLPipeline::getStencil() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.stencil;
 }
 
@@ -160,36 +175,36 @@ GPUPipelineStencil GLPipeline::getStencil() {
 // ------------------------------
 
 float GLPipeline::getClearDepth() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.clear_depth;
 }
 
 int GLPipeline::getClearStencil() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.clear_stencil;
 }
 
 GPUColor GLPipeline::getClearColor() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.clear_color;
 }
 
 GPUColorMask GLPipeline::getColorMask() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.color_mask;
 }
 
 GPURectangle GLPipeline::getViewport() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.viewport;
 }
 
 GPURectangle GLPipeline::getScissor() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.scissor;
 }
 
 float GLPipeline::getLineWidth() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_state.line_width;
 }
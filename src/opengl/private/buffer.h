@@ -26,15 +26,45 @@ class GLBuffer : public GPUBuffer {
     public: // GL Attributes
         GLContext* m_ctx;
         void* m_mapping;
+        unsigned int m_hazard_tick;
+        bool m_stream;
         GLuint m_vbo;
 
     public: // Buffer Constructor
         friend GLContext;
+        friend class GLStreamBuffer;
         GLBuffer(GLContext* ctx);
         void destroy() override;
 };
 
-class GLVertexArray : GPUVertexArray {
+class GLFence;
+class GLStreamBuffer : public GPUStreamBuffer {
+    // GPU Stream Buffer Usage
+    GPUStreamAllocation allocate(int bytes, int alignment) override;
+    void advance() override;
+    GPUBuffer* getBuffer() override;
+
+    public: // GL Attributes
+        GLContext* m_ctx;
+        GLBuffer* m_buffer;
+        GLFence** m_fences;
+        unsigned char* m_mapping;
+        // Frame Region Cursor
+        int m_frames;
+        int m_current;
+        int m_cursor;
+        // Context Stream List
+        GLStreamBuffer* m_next;
+        GLStreamBuffer* m_prev;
+
+    public: // Stream Buffer Constructor
+        void advanceRegion();
+        friend GLContext;
+        GLStreamBuffer(GLContext* ctx, int bytes, int frames);
+        void destroy() override;
+};
+
+class GLVertexArray : public GPUVertexArray {
     // GPU Vertex Array: Register
     void useArrayBuffer(GPUBuffer* buffer) override;
     void useElementsBuffer(GPUBuffer* buffer) override;
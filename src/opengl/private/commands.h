@@ -4,6 +4,7 @@
 #define OPENGL_COMMANDS_H
 #include <nogpu/commands.h>
 #include "state.hpp"
+#include <atomic>
 
 typedef int GLint;
 typedef unsigned int GLuint;
@@ -16,12 +17,19 @@ GLbitfield toValue(GPUDrawClear flags);
 GLenum toValue(GPUDrawPrimitive primitive);
 GLenum toValue(GPUDrawElements mode);
 GLbitfield toValue(GPUMemoryBarrier flags);
+GLenum toValue(GPUQueryType type);
 
 class GLContext;
 class GLCommands;
 class GLFence : GPUFence {
     GLContext* m_ctx;
     GLsync m_sync;
+    // Fence Pool Chain
+    GLFence* m_next;
+    unsigned long long m_value;
+    // Fence Stamped by Commands Replay
+    bool m_recorded;
+    bool m_destroyed;
     // Fence Syncronization
     void waitCPU() override;
     void waitGPU() override;
@@ -30,18 +38,195 @@ class GLFence : GPUFence {
     protected:
         friend GLContext;
         friend GLCommands;
-        GLFence(GLContext* ctx);
+        friend class GLFenceQueue;
+        friend class GLStreamBuffer;
+        GLFence(GLContext* ctx, GLsync sync);
+        bool signaled();
+        bool unstamped();
         void destroy() override;
 };
 
+class GLQuery : GPUQuery {
+    GLContext* m_ctx;
+    GPUQueryType m_type;
+    GLenum m_target;
+    GLuint m_query;
+    bool m_active;
+    // Query Result
+    bool available() override;
+    unsigned long long result() override;
+    GPUQueryType getType() override;
+
+    protected:
+        friend GLContext;
+        friend GLCommands;
+        GLQuery(GLContext* ctx, GPUQueryType type);
+        void destroy() override;
+};
+
+// ---------------------------------
+// OpenGL GPU Fence Completion Queue
+// ---------------------------------
+
+typedef struct {
+    GLFence* fence;
+    GPUFenceCallback cb;
+    void* userdata;
+} GLFenceEntry;
+
+class GLFenceQueue : GPUFenceQueue {
+    GLContext* m_ctx;
+    GLFenceEntry* m_entries;
+    int m_head, m_count;
+    int m_capacity;
+
+    // Fence Completion Queue
+    void push(GPUFence* fence, GPUFenceCallback cb, void* userdata) override;
+    int poll() override;
+    void finish() override;
+
+    protected: // Fence Queue Constructor
+        GLFenceQueue(GLContext* ctx);
+        void fire(GLFenceEntry* entry);
+        void destroy() override;
+        friend GLContext;
+    public: // Context Fence Queue List
+        GLFenceQueue* m_next;
+        GLFenceQueue* m_prev;
+        int pollQueue();
+};
+
+// ---------------------------
+// OpenGL GPU Commands: Record
+// ---------------------------
+
+enum class GLCommandType : unsigned int {
+    CMD_USE_PIPELINE,
+    CMD_USE_VERTEX_ARRAY,
+    CMD_USE_BLOCK_BINDING,
+    CMD_USE_TEXTURE,
+    CMD_USE_TEXTURE_SAMPLER,
+    CMD_USE_FRAMEBUFFER_DRAW,
+    CMD_USE_FRAMEBUFFER_READ,
+    // OpenGL Command Rendering
+    CMD_DRAW_CLEAR,
+    CMD_DRAW_ARRAYS,
+    CMD_DRAW_ARRAYS_INSTANCED,
+    CMD_DRAW_ELEMENTS,
+    CMD_DRAW_ELEMENTS_BASE_VERTEX,
+    CMD_DRAW_ELEMENTS_INSTANCED,
+    CMD_DRAW_ELEMENTS_BASE_VERTEX_INSTANCED,
+    CMD_DRAW_ARRAYS_INDIRECT,
+    CMD_DRAW_ELEMENTS_INDIRECT,
+    CMD_DRAW_ELEMENTS_INDIRECT_COUNT,
+    CMD_EXECUTE_COMPUTE,
+    CMD_EXECUTE_COMPUTE_SYNC,
+    CMD_EXECUTE_COMPUTE_INDIRECT,
+    CMD_MEMORY_BARRIER,
+    // OpenGL Command Timer
+    CMD_TIMER_BEGIN,
+    CMD_TIMER_END,
+    // OpenGL Command Query
+    CMD_QUERY_BEGIN,
+    CMD_QUERY_END,
+    CMD_CONDITIONAL_BEGIN,
+    CMD_CONDITIONAL_END,
+    // OpenGL Command Fence
+    CMD_SYNC_FLUSH,
+    CMD_SYNC_FINISH,
+    CMD_SYNC_FENCE,
+    // OpenGL Bundle Baked Binds
+    CMD_BAKED_PIPELINE,
+    CMD_BAKED_VERTEX_ARRAY,
+    CMD_BAKED_BLOCK_BINDING,
+    CMD_BAKED_TEXTURE,
+    CMD_BAKED_FRAMEBUFFER_DRAW,
+    CMD_BAKED_FRAMEBUFFER_READ
+};
+
+typedef struct {
+    GLCommandType type;
+    unsigned int bytes;
+} GLCommandRecord;
+
+typedef struct {
+    union {
+        GLPipeline* pipeline;
+        GLVertexArray* vertex_array;
+        GLFrameBuffer* framebuffer;
+        GLFence* fence;
+        GLQuery* query;
+    };
+} GLCommandObject;
+
+typedef struct {
+    GLTextureSampler binding;
+    unsigned int key;
+} GLCommandSampler;
+
+typedef struct {
+    void* indices;
+    GLenum mode;
+    GLenum type;
+    int offset, count;
+    int base, instances;
+} GLCommandDraw;
+
+typedef struct {
+    GLbitfield bits;
+    int x, y, z;
+} GLCommandExecute;
+
+typedef struct {
+    GLBuffer* buffer;
+    GLBuffer* count;
+    GLenum mode;
+    GLenum type;
+    int offset, count_offset;
+    int max_count, stride;
+} GLCommandIndirect;
+
+typedef struct {
+    const char* label;
+} GLCommandTimer;
+
 // -------------------
 // OpenGL GPU Commands
 // -------------------
 
+enum class GLCommandsMode : unsigned int {
+    COMMANDS_IMMEDIATE,
+    COMMANDS_DEFERRED,
+    COMMANDS_BUNDLE
+};
+
 class GLCommands : GPUCommands {
     GLCommandsState m_state;
     GLState *m_ctx_state;
     GLContext* m_ctx;
+    // Commands Linear Arena
+    unsigned char* m_arena;
+    unsigned int m_arena_bytes;
+    unsigned int m_arena_capacity;
+    std::atomic<bool> m_recording;
+    GLCommandsMode m_mode;
+    bool m_state_stale;
+    // Commands Bundle Objects
+    void** m_bundle_objects;
+    int m_bundle_objects_count;
+    int m_bundle_objects_capacity;
+    GLCommands* m_bundle_next;
+    bool m_bundle_linked;
+    bool m_bundle_valid;
+    // Commands Bundle Baking
+    unsigned char* m_bake;
+    unsigned int m_bake_capacity;
+    // Commands Multi-Draw Arrays
+    GLint* m_multi_first;
+    GLint* m_multi_count;
+    GLint* m_multi_base;
+    void** m_multi_indices;
+    int m_multi_capacity;
 
     // GPU Command Record
     void beginCommands() override;
@@ -50,6 +235,14 @@ class GLCommands : GPUCommands {
     void syncFlush() override;
     void syncFinish() override;
     GPUFence* syncFence() override;
+    // GPU Command Timer
+    void beginTimer(const char* label) override;
+    void endTimer() override;
+    // GPU Command Query
+    void beginQuery(GPUQuery *query) override;
+    void endQuery(GPUQuery *query) override;
+    void beginConditional(GPUQuery *query) override;
+    void endConditional() override;
 
     // GPU Command State
     void usePipeline(GPUPipeline *pipeline) override;
@@ -57,6 +250,7 @@ class GLCommands : GPUCommands {
     void useBlockBinding(GPUBuffer *buffer, GPUBlockBinding bind, int index) override;
     void useBlockBindingRange(GPUBuffer *buffer, GPUBlockBinding bind, int index, int offset, int size) override;
     void useTexture(GPUTexture *texture, int index) override;
+    void useTextureSampler(GPUTexture *texture, GPUUniform *sampler) override;
     void useFrameBuffer(GPUFrameBuffer *framebuffer) override;
     void useFrameBufferDraw(GPUFrameBuffer *framebuffer) override;
     void useFrameBufferRead(GPUFrameBuffer *framebuffer) override;
@@ -70,12 +264,76 @@ class GLCommands : GPUCommands {
     void drawArraysInstanced(GPUDrawPrimitive type, int offset, int count, int instance_count) override;
     void drawElementsInstanced(GPUDrawPrimitive type, int offset, int count, GPUDrawElements element, int instance_count) override;
     void drawElementsBaseVertexInstanced(GPUDrawPrimitive type, int offset, int count, int base, GPUDrawElements element, int instance_count) override;
+    void drawArraysIndirect(GPUDrawPrimitive type, GPUBuffer *indirect, int offset) override;
+    void drawElementsIndirect(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset) override;
+    void multiDrawElementsIndirectCount(GPUDrawPrimitive type, GPUDrawElements element, GPUBuffer *indirect, int offset, GPUBuffer *count, int count_offset, int max_count, int stride) override;
     void executeComputeSync(int x, int y, int z) override;
     void executeCompute(int x, int y, int z) override;
+    void executeComputeIndirect(GPUBuffer *indirect, int offset) override;
     void memoryBarrier(GPUMemoryBarrier from, GPUMemoryBarrier to) override;
 
     protected: // Commands Constructor
-        GLCommands(GLContext ctx);
+        GLCommands(GLContext* ctx, GLCommandsMode mode);
+        bool prepareEffects();
+        bool prepareShaders(bool vertex);
+        void recordCommand(GLCommandType type, void* data, unsigned int bytes);
+        bool applyCommand(GLCommandType type, void* data);
+        void executeCommand(GLCommandType type, void* data, bool replay);
+        void replayCommands();
+        unsigned char* coalesceDraws(unsigned char* cursor, unsigned char* end);
+        void executeQuery(GLCommandType type, GLQuery* query);
+        // Commands Bundle Baking
+        void bundleObject(void* object);
+        bool bundleCommand(GLCommandType type, void* data, GLCommandsState &applied);
+        void bakeBinds(GLCommandsState &applied);
+        void bakeBundle();
+        bool checkBundle(void* object);
+        void rewindFences();
+        void destroy() override;
+        friend GLContext;
+        friend GLState;
+};
+
+// ---------------------
+// OpenGL GPU Draw Queue
+// ---------------------
+
+typedef struct {
+    GPUDrawItem item;
+    int textures_offset;
+    int bindings_offset;
+    int target;
+} GLDrawItem;
+
+class GLDrawQueue : public GPUDrawQueue {
+    GLDrawItem* m_items;
+    GPUDrawTexture* m_textures;
+    GPUDrawBinding* m_bindings;
+    int m_items_count, m_items_capacity;
+    int m_textures_count, m_textures_capacity;
+    int m_bindings_count, m_bindings_capacity;
+    // Draw Queue Render Targets
+    GPUFrameBuffer** m_targets;
+    int m_targets_count, m_targets_capacity;
+    // Draw Queue Sorting
+    unsigned long long* m_keys;
+    unsigned int* m_order;
+    int m_sort_capacity;
+    GPUDrawQueueStats m_stats;
+    GLContext* m_ctx;
+
+    // GPU Draw Queue
+    void clearQueue() override;
+    void pushDraw(GPUDrawItem item) override;
+    void dispatchQueue(GPUCommands* commands, GPUDrawQueueMode mode) override;
+    GPUDrawQueueStats getStats() override;
+
+    protected: // Draw Queue Constructor
+        GLDrawQueue(GLContext* ctx);
+        int targetOrdinal(GPUFrameBuffer* framebuffer);
+        unsigned long long computeKey(GLDrawItem* item);
+        void sortQueue();
+        int countChanges(unsigned int* order);
         void destroy() override;
         friend GLContext;
 };
@@ -3,23 +3,41 @@
 #ifndef OPENGL_CONTEXT_H
 #define OPENGL_CONTEXT_H
 #include <nogpu/context.h>
+#include <nogpu_trace.h>
 #include "state.hpp"
 #include "driver.h"
+#include "timer.h"
+#include <mutex>
 
 // ------------------
 // OpenGL GPU Context
 // ------------------
 
+class GLFence;
+class GLFenceQueue;
+class GLStreamBuffer;
+typedef struct __GLsync *GLsync;
 class GLContext : GPUContext {
     GLDriver* m_driver;
     GLDevice* m_device;
     #if defined(__unix__)
         LinuxEGLContext m_egl_context;
     #endif
+    // Context Fence Pool
+    std::mutex m_fence_mutex;
+    GLFence* m_fence_pool = nullptr;
+    GLFence* m_timeline_first = nullptr;
+    GLFence* m_timeline_last = nullptr;
+    unsigned long long m_timeline_value = 0;
+    unsigned long long m_timeline_completed = 0;
+    GLFenceQueue* m_fence_queues = nullptr;
+    GLStreamBuffer* m_stream_buffers = nullptr;
+    GLTimers m_timers;
 
     // GPU Object Creation
     GPUBuffer* createBuffer() override;
     GPUVertexArray* createVertexArray() override;
+    GPUStreamBuffer* createStreamBuffer(int bytes, int frames) override;
     GPUTextureBuffer* createTextureBuffer(GPUBuffer* buffer, GPUTexturePixelType type) override;
     // GPU Texture Objects: Standard
     GPUTexture1D* createTexture1D(GPUTexturePixelType type) override;
@@ -41,6 +59,18 @@ class GLContext : GPUContext {
     GPUProgram* createProgram() override;
     GPUPipeline* createPipeline() override;
     GPUCommands* createCommands() override;
+    GPUCommands* createCommandsDeferred() override;
+    GPUCommands* createCommandsBundle() override;
+    GPUDrawQueue* createDrawQueue() override;
+    GPUFenceQueue* createFenceQueue() override;
+    GPUQuery* createQuery(GPUQueryType type) override;
+    void submit(GPUCommands** list, int count) override;
+    // GPU Rendering Timeline
+    unsigned long long signal() override;
+    void waitUntil(unsigned long long value) override;
+    unsigned long long completedValue() override;
+    // GPU Rendering Timers
+    GPUTimerTable getTimers() override;
     // GPU Rendering Surface: Driver
     void surfaceSwap() override;
     void surfaceResize(int w, int h) override;
@@ -49,16 +79,28 @@ class GLContext : GPUContext {
     bool surfaceRGBA() override;
 
     public: // Make Current
-        void makeCurrent(void* object);
-        void makeCurrentTexture(void* object);
+        GPUTraceScope makeCurrent(void* object, const char* name = __nogpu_function());
+        GPUTraceScope makeCurrentTexture(void* object, const char* name = __nogpu_function());
+        GPUTraceScope makeRecord(void* object, const char* name = __nogpu_function());
         GLState* manipulateState();
+        GPUNameTable* manipulateNames();
         GPUFence* syncFence();
+    public: // Fence Pool
+        GLFence* acquireFence(GLsync sync);
+        void releaseFence(GLFence* fence);
+        void retireTimeline(unsigned long long value);
+        void disposeFences();
+        void pollFenceQueues();
+        void advanceStreamBuffers();
     protected: // Commands Constructor
         void destroy() override;
         friend GLDriver;
         friend GLDevice;
         friend class GLPipeline;
         friend class GLCommands;
+        friend class GLDrawQueue;
+        friend class GLFenceQueue;
+        friend class GLStreamBuffer;
 };
 
 #endif // OPENGL_CONTEXT_H
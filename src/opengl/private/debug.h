@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#ifndef OPENGL_DEBUG_H
+#define OPENGL_DEBUG_H
+#include <nogpu/device.h>
+#include <nogpu_map.h>
+#include "glad.h"
+#include <mutex>
+
+// ---------------------------
+// OpenGL Debug Message Counts
+// ---------------------------
+
+class GLDebugMessages {
+    typedef struct GLDebugEntry {
+        GLenum source;
+        GLenum type;
+        GLuint id;
+        unsigned int count;
+        unsigned int suppressed;
+        unsigned int pending;
+        unsigned long long summary;
+        char* message;
+        struct GLDebugEntry* next;
+    } GLDebugEntry;
+
+    typedef struct {
+        GLenum source;
+        GLenum type;
+        GLuint id;
+        char* message;
+    } GLDebugQueued;
+
+    GPUHashmap<GLDebugEntry*> m_entries;
+    unsigned long long m_interval;
+    GLDebugEntry* lookup(GLenum source, GLenum type, GLuint id);
+    void flush();
+    // Asynchronous Debug Queue
+    std::mutex m_queue_mutex;
+    GLDebugQueued m_queue[256];
+    int m_queue_count;
+    unsigned int m_queue_dropped;
+
+    public: // Debug Messages Aggregation
+        void report(GLenum source, GLenum type, GLuint id, const char* message);
+        void queue(GLenum source, GLenum type, GLuint id, const char* message, int length);
+        void drain();
+        int stats(GPUDebugStats* stats, int capacity);
+        void setInterval(int ms);
+    public: // Debug Messages Constructor
+        GLDebugMessages();
+        ~GLDebugMessages();
+};
+
+#endif // OPENGL_DEBUG_H
@@ -5,6 +5,7 @@
 #include <nogpu/device.h>
 #include <nogpu_private.h>
 #include "state.hpp"
+#include "debug.h"
 
 #if defined(__unix__)
 #include <EGL/egl.h>
@@ -70,11 +71,13 @@ class GLDriver : public GPUDriver {
     GLContext* m_ctx_current = nullptr;
     GPUDriverMode m_mode = GPUDriverMode::DRIVER_MODE_NORMAL;
     unsigned int m_features = 0;
+    bool m_debug_sync = true;
     bool m_vsync = true;
 
     GPUDevice* impl__createDevice(GPUDeviceOption option, int samples, bool rgba) override;
     void impl__setVerticalSync(bool value) override;
     bool impl__getVerticalSync() override;
+    void impl__setDebugSynchronous(bool value) override;
     bool impl__getDriverFeature(GPUDriverFeature feature) override;
     GPUDriverOption impl__getDriverOption() override;
     bool impl__shutdown() override;
@@ -101,6 +104,8 @@ class GLDevice : public GPUDevice {
     GPUDeviceOption m_option;
     GLDriver* m_driver;
     GLState m_state;
+    GPUNameTable m_names;
+    GLDebugMessages m_debug;
     int m_samples;
     bool m_rgba;
     bool m_vsync;
@@ -112,6 +117,11 @@ class GLDevice : public GPUDevice {
     int checkSamples() override;
     bool checkRGBA() override;
     bool destroy() override;
+    // Debug Message Counters
+    int getDebugStats(GPUDebugStats* stats, int capacity) override;
+    void setDebugInterval(int ms) override;
+    // State Change Counters
+    GPUStateCounters getStateCounters() override;
 
     // Context Creation: Linux
     #if defined(__unix__)
@@ -122,7 +132,7 @@ class GLDevice : public GPUDevice {
 
     protected: // OpenGL Device Constructor
         GLDevice(GLDriver* driver, GPUDeviceOption device, int samples, bool rgba);
-        void prepareContextDebug(GPUDriverMode mode);
+        void prepareContextDebug(GPUDriverMode mode, bool sync);
         void prepareContextState();
 
         friend GLDriver;
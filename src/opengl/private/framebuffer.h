@@ -55,7 +55,7 @@ class GLRenderBuffer : GPURenderBuffer {
 // OpenGL GPU: Framebuffer
 // -----------------------
 
-class GLFrameBuffer : GPUFrameBuffer {
+class GLFrameBuffer : public GPUFrameBuffer {
     GLContext* m_ctx;
     typedef struct {
         GLRenderBuffer* target;
@@ -72,7 +72,7 @@ class GLFrameBuffer : GPUFrameBuffer {
     } GLRenderIndexes;
 
     private: // Framebuffer Internals
-        GPUHashmap<GLRenderLink> m_colors;
+        GPUHashmap<GLRenderLink, 4> m_colors;
         GLRenderIndexes m_colors_index;
         GLRenderLink m_depth;
         GLRenderLink m_stencil;
@@ -118,6 +118,7 @@ class GLFrameBuffer : GPUFrameBuffer {
         void reserveIndexes(int count);
         void updateIndexes();
         friend GLContext;
+        friend class GLState;
 };
 
 #endif // OPENGL_FRAMEBUFFER_H
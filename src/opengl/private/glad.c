@@ -37,12 +37,17 @@ int GLAD_GL_VERSION_3_2 = 0;
 int GLAD_GL_VERSION_3_3 = 0;
 int GLAD_GL_ARB_ES2_compatibility = 0;
 int GLAD_GL_ARB_ES3_compatibility = 0;
+int GLAD_GL_ARB_buffer_storage = 0;
 int GLAD_GL_ARB_clear_buffer_object = 0;
 int GLAD_GL_ARB_clear_texture = 0;
 int GLAD_GL_ARB_compute_shader = 0;
 int GLAD_GL_ARB_debug_output = 0;
+int GLAD_GL_ARB_draw_indirect = 0;
 int GLAD_GL_ARB_get_texture_sub_image = 0;
 int GLAD_GL_ARB_gl_spirv = 0;
+int GLAD_GL_ARB_indirect_parameters = 0;
+int GLAD_GL_ARB_multi_draw_indirect = 0;
+int GLAD_GL_ARB_pipeline_statistics_query = 0;
 int GLAD_GL_ARB_shader_atomic_counters = 0;
 int GLAD_GL_ARB_shader_image_load_store = 0;
 int GLAD_GL_ARB_shader_image_size = 0;
@@ -84,6 +89,7 @@ PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
 PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
 PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
 PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
 PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
 PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
 PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
@@ -143,11 +149,13 @@ PFNGLDISABLEIPROC glad_glDisablei = NULL;
 PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
 PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
 PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
 PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
 PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
 PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
 PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
 PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
 PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
 PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
 PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
@@ -266,8 +274,12 @@ PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
 PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
 PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
 PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC glad_glMultiDrawArraysIndirectCountARB = NULL;
 PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
 PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC glad_glMultiDrawElementsIndirectCountARB = NULL;
 PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
 PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
 PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
@@ -825,6 +837,10 @@ static void glad_gl_load_GL_ARB_ES2_compatibility( GLADuserptrloadfunc load, voi
     glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC) load(userptr, "glReleaseShaderCompiler");
     glad_glShaderBinary = (PFNGLSHADERBINARYPROC) load(userptr, "glShaderBinary");
 }
+static void glad_gl_load_GL_ARB_buffer_storage( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_buffer_storage) return;
+    glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC) load(userptr, "glBufferStorage");
+}
 static void glad_gl_load_GL_ARB_clear_buffer_object( GLADuserptrloadfunc load, void* userptr) {
     if(!GLAD_GL_ARB_clear_buffer_object) return;
     glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC) load(userptr, "glClearBufferData");
@@ -847,6 +863,11 @@ static void glad_gl_load_GL_ARB_debug_output( GLADuserptrloadfunc load, void* us
     glad_glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC) load(userptr, "glDebugMessageInsertARB");
     glad_glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC) load(userptr, "glGetDebugMessageLogARB");
 }
+static void glad_gl_load_GL_ARB_draw_indirect( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_draw_indirect) return;
+    glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC) load(userptr, "glDrawArraysIndirect");
+    glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC) load(userptr, "glDrawElementsIndirect");
+}
 static void glad_gl_load_GL_ARB_get_texture_sub_image( GLADuserptrloadfunc load, void* userptr) {
     if(!GLAD_GL_ARB_get_texture_sub_image) return;
     glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) load(userptr, "glGetCompressedTextureSubImage");
@@ -856,6 +877,16 @@ static void glad_gl_load_GL_ARB_gl_spirv( GLADuserptrloadfunc load, void* userpt
     if(!GLAD_GL_ARB_gl_spirv) return;
     glad_glSpecializeShaderARB = (PFNGLSPECIALIZESHADERARBPROC) load(userptr, "glSpecializeShaderARB");
 }
+static void glad_gl_load_GL_ARB_indirect_parameters( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_indirect_parameters) return;
+    glad_glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC) load(userptr, "glMultiDrawArraysIndirectCountARB");
+    glad_glMultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC) load(userptr, "glMultiDrawElementsIndirectCountARB");
+}
+static void glad_gl_load_GL_ARB_multi_draw_indirect( GLADuserptrloadfunc load, void* userptr) {
+    if(!GLAD_GL_ARB_multi_draw_indirect) return;
+    glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC) load(userptr, "glMultiDrawArraysIndirect");
+    glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) load(userptr, "glMultiDrawElementsIndirect");
+}
 static void glad_gl_load_GL_ARB_shader_atomic_counters( GLADuserptrloadfunc load, void* userptr) {
     if(!GLAD_GL_ARB_shader_atomic_counters) return;
     glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) load(userptr, "glGetActiveAtomicCounterBufferiv");
@@ -1046,6 +1077,7 @@ static unsigned int glad_gl_crc32_extensions_gl[] = {
         0x50a89b, // GL_ARB_ES2_compatibility
         0x22eb0518, // GL_ARB_gl_spirv
         0x299a86ca, // GL_ARB_texture_compression_bptc
+        0x39e5d1b8, // GL_ARB_draw_indirect
         0x3f22171c, // GL_EXT_texture_compression_s3tc
         0x4a03d323, // GL_ARB_texture_buffer_range
         0x56ea549b, // GL_ARB_texture_storage_multisample
@@ -1054,8 +1086,11 @@ static unsigned int glad_gl_crc32_extensions_gl[] = {
         0x717a6418, // GL_ARB_clear_buffer_object
         0x7a21b127, // GL_ARB_shader_atomic_counters
         0x7b80afe6, // GL_ARB_texture_cube_map_array
+        0x7db3d6ed, // GL_ARB_multi_draw_indirect
+        0x86cf9c0d, // GL_ARB_buffer_storage
         0x8a58e0da, // GL_ARB_spirv_extensions
         0x98127c6a, // GL_ARB_get_texture_sub_image
+        0x9c68ab17, // GL_ARB_indirect_parameters
         0xad98b9af, // GL_ARB_uniform_buffer_object
         0xb04ac249, // GL_ARB_compute_shader
         0xb9ab7373, // GL_ARB_ES3_compatibility
@@ -1065,34 +1100,40 @@ static unsigned int glad_gl_crc32_extensions_gl[] = {
         0xe9fdddb4, // GL_KHR_texture_compression_astc_ldr
         0xeef47568, // GL_KHR_texture_compression_astc_hdr
         0xf48228f4, // GL_ARB_shader_image_load_store
+        0xfa08edbb, // GL_ARB_pipeline_statistics_query
         0xffffffff
 };
 
 static void glad_gl_find_extensions_gl(void) {
-    unsigned int glad_gl_flags_extensions_gl[23] = {0};
-    glad_gl_check_extensions(glad_gl_flags_extensions_gl, glad_gl_crc32_extensions_gl, 22);
+    unsigned int glad_gl_flags_extensions_gl[28] = {0};
+    glad_gl_check_extensions(glad_gl_flags_extensions_gl, glad_gl_crc32_extensions_gl, 27);
     GLAD_GL_ARB_ES2_compatibility = (glad_gl_flags_extensions_gl[0] != 0);
     GLAD_GL_ARB_gl_spirv = (glad_gl_flags_extensions_gl[1] != 0);
     GLAD_GL_ARB_texture_compression_bptc = (glad_gl_flags_extensions_gl[2] != 0);
-    GLAD_GL_EXT_texture_compression_s3tc = (glad_gl_flags_extensions_gl[3] != 0);
-    GLAD_GL_ARB_texture_buffer_range = (glad_gl_flags_extensions_gl[4] != 0);
-    GLAD_GL_ARB_texture_storage_multisample = (glad_gl_flags_extensions_gl[5] != 0);
-    GLAD_GL_ARB_clear_texture = (glad_gl_flags_extensions_gl[6] != 0);
-    GLAD_GL_ARB_shader_storage_buffer_object = (glad_gl_flags_extensions_gl[7] != 0);
-    GLAD_GL_ARB_clear_buffer_object = (glad_gl_flags_extensions_gl[8] != 0);
-    GLAD_GL_ARB_shader_atomic_counters = (glad_gl_flags_extensions_gl[9] != 0);
-    GLAD_GL_ARB_texture_cube_map_array = (glad_gl_flags_extensions_gl[10] != 0);
-    GLAD_GL_ARB_spirv_extensions = (glad_gl_flags_extensions_gl[11] != 0);
-    GLAD_GL_ARB_get_texture_sub_image = (glad_gl_flags_extensions_gl[12] != 0);
-    GLAD_GL_ARB_uniform_buffer_object = (glad_gl_flags_extensions_gl[13] != 0);
-    GLAD_GL_ARB_compute_shader = (glad_gl_flags_extensions_gl[14] != 0);
-    GLAD_GL_ARB_ES3_compatibility = (glad_gl_flags_extensions_gl[15] != 0);
-    GLAD_GL_ARB_texture_storage = (glad_gl_flags_extensions_gl[16] != 0);
-    GLAD_GL_ARB_debug_output = (glad_gl_flags_extensions_gl[17] != 0);
-    GLAD_GL_ARB_shader_image_size = (glad_gl_flags_extensions_gl[18] != 0);
-    GLAD_GL_KHR_texture_compression_astc_ldr = (glad_gl_flags_extensions_gl[19] != 0);
-    GLAD_GL_KHR_texture_compression_astc_hdr = (glad_gl_flags_extensions_gl[20] != 0);
-    GLAD_GL_ARB_shader_image_load_store = (glad_gl_flags_extensions_gl[21] != 0);
+    GLAD_GL_ARB_draw_indirect = (glad_gl_flags_extensions_gl[3] != 0);
+    GLAD_GL_EXT_texture_compression_s3tc = (glad_gl_flags_extensions_gl[4] != 0);
+    GLAD_GL_ARB_texture_buffer_range = (glad_gl_flags_extensions_gl[5] != 0);
+    GLAD_GL_ARB_texture_storage_multisample = (glad_gl_flags_extensions_gl[6] != 0);
+    GLAD_GL_ARB_clear_texture = (glad_gl_flags_extensions_gl[7] != 0);
+    GLAD_GL_ARB_shader_storage_buffer_object = (glad_gl_flags_extensions_gl[8] != 0);
+    GLAD_GL_ARB_clear_buffer_object = (glad_gl_flags_extensions_gl[9] != 0);
+    GLAD_GL_ARB_shader_atomic_counters = (glad_gl_flags_extensions_gl[10] != 0);
+    GLAD_GL_ARB_texture_cube_map_array = (glad_gl_flags_extensions_gl[11] != 0);
+    GLAD_GL_ARB_multi_draw_indirect = (glad_gl_flags_extensions_gl[12] != 0);
+    GLAD_GL_ARB_buffer_storage = (glad_gl_flags_extensions_gl[13] != 0);
+    GLAD_GL_ARB_spirv_extensions = (glad_gl_flags_extensions_gl[14] != 0);
+    GLAD_GL_ARB_get_texture_sub_image = (glad_gl_flags_extensions_gl[15] != 0);
+    GLAD_GL_ARB_indirect_parameters = (glad_gl_flags_extensions_gl[16] != 0);
+    GLAD_GL_ARB_uniform_buffer_object = (glad_gl_flags_extensions_gl[17] != 0);
+    GLAD_GL_ARB_compute_shader = (glad_gl_flags_extensions_gl[18] != 0);
+    GLAD_GL_ARB_ES3_compatibility = (glad_gl_flags_extensions_gl[19] != 0);
+    GLAD_GL_ARB_texture_storage = (glad_gl_flags_extensions_gl[20] != 0);
+    GLAD_GL_ARB_debug_output = (glad_gl_flags_extensions_gl[21] != 0);
+    GLAD_GL_ARB_shader_image_size = (glad_gl_flags_extensions_gl[22] != 0);
+    GLAD_GL_KHR_texture_compression_astc_ldr = (glad_gl_flags_extensions_gl[23] != 0);
+    GLAD_GL_KHR_texture_compression_astc_hdr = (glad_gl_flags_extensions_gl[24] != 0);
+    GLAD_GL_ARB_shader_image_load_store = (glad_gl_flags_extensions_gl[25] != 0);
+    GLAD_GL_ARB_pipeline_statistics_query = (glad_gl_flags_extensions_gl[26] != 0);
 }
 
 // ------------------
@@ -1123,12 +1164,16 @@ int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
 
     glad_gl_find_extensions_gl();
     glad_gl_load_GL_ARB_ES2_compatibility(load, userptr);
+    glad_gl_load_GL_ARB_buffer_storage(load, userptr);
     glad_gl_load_GL_ARB_clear_buffer_object(load, userptr);
     glad_gl_load_GL_ARB_clear_texture(load, userptr);
     glad_gl_load_GL_ARB_compute_shader(load, userptr);
     glad_gl_load_GL_ARB_debug_output(load, userptr);
+    glad_gl_load_GL_ARB_draw_indirect(load, userptr);
     glad_gl_load_GL_ARB_get_texture_sub_image(load, userptr);
     glad_gl_load_GL_ARB_gl_spirv(load, userptr);
+    glad_gl_load_GL_ARB_indirect_parameters(load, userptr);
+    glad_gl_load_GL_ARB_multi_draw_indirect(load, userptr);
     glad_gl_load_GL_ARB_shader_atomic_counters(load, userptr);
     glad_gl_load_GL_ARB_shader_image_load_store(load, userptr);
     glad_gl_load_GL_ARB_shader_storage_buffer_object(load, userptr);
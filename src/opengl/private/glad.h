@@ -5,7 +5,7 @@
  *
  * Generator: C/C++
  * Specification: gl
- * Extensions: 22
+ * Extensions: 27
  *
  * APIs:
  *  - gl:core=3.3
@@ -19,10 +19,10 @@
  *  - ON_DEMAND = False
  *
  * Commandline:
- *    --api='gl:core=3.3' --extensions='GL_ARB_ES2_compatibility,GL_ARB_ES3_compatibility,GL_ARB_clear_buffer_object,GL_ARB_clear_texture,GL_ARB_compute_shader,GL_ARB_debug_output,GL_ARB_get_texture_sub_image,GL_ARB_gl_spirv,GL_ARB_shader_atomic_counters,GL_ARB_shader_image_load_store,GL_ARB_shader_image_size,GL_ARB_shader_storage_buffer_object,GL_ARB_spirv_extensions,GL_ARB_texture_buffer_range,GL_ARB_texture_compression_bptc,GL_ARB_texture_cube_map_array,GL_ARB_texture_storage,GL_ARB_texture_storage_multisample,GL_ARB_uniform_buffer_object,GL_EXT_texture_compression_s3tc,GL_KHR_texture_compression_astc_hdr,GL_KHR_texture_compression_astc_ldr' c
+ *    --api='gl:core=3.3' --extensions='GL_ARB_ES2_compatibility,GL_ARB_ES3_compatibility,GL_ARB_buffer_storage,GL_ARB_clear_buffer_object,GL_ARB_clear_texture,GL_ARB_compute_shader,GL_ARB_debug_output,GL_ARB_draw_indirect,GL_ARB_get_texture_sub_image,GL_ARB_gl_spirv,GL_ARB_indirect_parameters,GL_ARB_multi_draw_indirect,GL_ARB_pipeline_statistics_query,GL_ARB_shader_atomic_counters,GL_ARB_shader_image_load_store,GL_ARB_shader_image_size,GL_ARB_shader_storage_buffer_object,GL_ARB_spirv_extensions,GL_ARB_texture_buffer_range,GL_ARB_texture_compression_bptc,GL_ARB_texture_cube_map_array,GL_ARB_texture_storage,GL_ARB_texture_storage_multisample,GL_ARB_uniform_buffer_object,GL_EXT_texture_compression_s3tc,GL_KHR_texture_compression_astc_hdr,GL_KHR_texture_compression_astc_ldr' c
  *
  * Online:
- *    http://glad.sh/#api=gl%3Acore%3D3.3&extensions=GL_ARB_ES2_compatibility%2CGL_ARB_ES3_compatibility%2CGL_ARB_clear_buffer_object%2CGL_ARB_clear_texture%2CGL_ARB_compute_shader%2CGL_ARB_debug_output%2CGL_ARB_get_texture_sub_image%2CGL_ARB_gl_spirv%2CGL_ARB_shader_atomic_counters%2CGL_ARB_shader_image_load_store%2CGL_ARB_shader_image_size%2CGL_ARB_shader_storage_buffer_object%2CGL_ARB_spirv_extensions%2CGL_ARB_texture_buffer_range%2CGL_ARB_texture_compression_bptc%2CGL_ARB_texture_cube_map_array%2CGL_ARB_texture_storage%2CGL_ARB_texture_storage_multisample%2CGL_ARB_uniform_buffer_object%2CGL_EXT_texture_compression_s3tc%2CGL_KHR_texture_compression_astc_hdr%2CGL_KHR_texture_compression_astc_ldr&generator=c&options=
+ *    http://glad.sh/#api=gl%3Acore%3D3.3&extensions=GL_ARB_ES2_compatibility%2CGL_ARB_ES3_compatibility%2CGL_ARB_buffer_storage%2CGL_ARB_clear_buffer_object%2CGL_ARB_clear_texture%2CGL_ARB_compute_shader%2CGL_ARB_debug_output%2CGL_ARB_draw_indirect%2CGL_ARB_get_texture_sub_image%2CGL_ARB_gl_spirv%2CGL_ARB_indirect_parameters%2CGL_ARB_multi_draw_indirect%2CGL_ARB_pipeline_statistics_query%2CGL_ARB_shader_atomic_counters%2CGL_ARB_shader_image_load_store%2CGL_ARB_shader_image_size%2CGL_ARB_shader_storage_buffer_object%2CGL_ARB_spirv_extensions%2CGL_ARB_texture_buffer_range%2CGL_ARB_texture_compression_bptc%2CGL_ARB_texture_cube_map_array%2CGL_ARB_texture_storage%2CGL_ARB_texture_storage_multisample%2CGL_ARB_uniform_buffer_object%2CGL_EXT_texture_compression_s3tc%2CGL_KHR_texture_compression_astc_hdr%2CGL_KHR_texture_compression_astc_ldr&generator=c&options=
  *
  */
 
@@ -236,11 +236,13 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_BOOL_VEC4 0x8B59
 #define GL_BUFFER_ACCESS 0x88BB
 #define GL_BUFFER_ACCESS_FLAGS 0x911F
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
 #define GL_BUFFER_MAPPED 0x88BC
 #define GL_BUFFER_MAP_LENGTH 0x9120
 #define GL_BUFFER_MAP_OFFSET 0x9121
 #define GL_BUFFER_MAP_POINTER 0x88BD
 #define GL_BUFFER_SIZE 0x8764
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
 #define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
 #define GL_BUFFER_USAGE 0x8765
 #define GL_BYTE 0x1400
@@ -250,6 +252,10 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_CLAMP_TO_EDGE 0x812F
 #define GL_CLEAR 0x1500
 #define GL_CLEAR_TEXTURE 0x9365
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_CLIPPING_INPUT_PRIMITIVES_ARB 0x82F6
+#define GL_CLIPPING_OUTPUT_PRIMITIVES_ARB 0x82F7
 #define GL_CLIP_DISTANCE0 0x3000
 #define GL_CLIP_DISTANCE1 0x3001
 #define GL_CLIP_DISTANCE2 0x3002
@@ -357,6 +363,7 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_COMPRESSED_TEXTURE_FORMATS 0x86A3
 #define GL_COMPUTE_SHADER 0x91B9
 #define GL_COMPUTE_SHADER_BIT 0x00000020
+#define GL_COMPUTE_SHADER_INVOCATIONS_ARB 0x82F5
 #define GL_COMPUTE_WORK_GROUP_SIZE 0x8267
 #define GL_CONDITION_SATISFIED 0x911C
 #define GL_CONSTANT_ALPHA 0x8003
@@ -442,11 +449,14 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_DRAW_BUFFER9 0x882E
 #define GL_DRAW_FRAMEBUFFER 0x8CA9
 #define GL_DRAW_FRAMEBUFFER_BINDING 0x8CA6
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#define GL_DRAW_INDIRECT_BUFFER_BINDING 0x8F43
 #define GL_DST_ALPHA 0x0304
 #define GL_DST_COLOR 0x0306
 #define GL_DYNAMIC_COPY 0x88EA
 #define GL_DYNAMIC_DRAW 0x88E8
 #define GL_DYNAMIC_READ 0x88E9
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
 #define GL_ELEMENT_ARRAY_BARRIER_BIT 0x00000002
 #define GL_ELEMENT_ARRAY_BUFFER 0x8893
 #define GL_ELEMENT_ARRAY_BUFFER_BINDING 0x8895
@@ -475,6 +485,7 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_FLOAT_VEC4 0x8B52
 #define GL_FRAGMENT_SHADER 0x8B30
 #define GL_FRAGMENT_SHADER_DERIVATIVE_HINT 0x8B8B
+#define GL_FRAGMENT_SHADER_INVOCATIONS_ARB 0x82F4
 #define GL_FRAMEBUFFER 0x8D40
 #define GL_FRAMEBUFFER_ATTACHMENT_ALPHA_SIZE 0x8215
 #define GL_FRAMEBUFFER_ATTACHMENT_BLUE_SIZE 0x8214
@@ -514,6 +525,7 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_GEOMETRY_INPUT_TYPE 0x8917
 #define GL_GEOMETRY_OUTPUT_TYPE 0x8918
 #define GL_GEOMETRY_SHADER 0x8DD9
+#define GL_GEOMETRY_SHADER_PRIMITIVES_EMITTED_ARB 0x82F3
 #define GL_GEOMETRY_VERTICES_OUT 0x8916
 #define GL_GEQUAL 0x0206
 #define GL_GREATER 0x0204
@@ -606,9 +618,11 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_LOW_FLOAT 0x8DF0
 #define GL_LOW_INT 0x8DF3
 #define GL_MAJOR_VERSION 0x821B
+#define GL_MAP_COHERENT_BIT 0x0080
 #define GL_MAP_FLUSH_EXPLICIT_BIT 0x0010
 #define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
 #define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#define GL_MAP_PERSISTENT_BIT 0x0040
 #define GL_MAP_READ_BIT 0x0001
 #define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
 #define GL_MAP_WRITE_BIT 0x0002
@@ -757,6 +771,8 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_PACK_SKIP_PIXELS 0x0D04
 #define GL_PACK_SKIP_ROWS 0x0D03
 #define GL_PACK_SWAP_BYTES 0x0D00
+#define GL_PARAMETER_BUFFER_ARB 0x80EE
+#define GL_PARAMETER_BUFFER_BINDING_ARB 0x80EF
 #define GL_PIXEL_BUFFER_BARRIER_BIT 0x00000080
 #define GL_PIXEL_PACK_BUFFER 0x88EB
 #define GL_PIXEL_PACK_BUFFER_BINDING 0x88ED
@@ -778,6 +794,7 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_POLYGON_SMOOTH 0x0B41
 #define GL_POLYGON_SMOOTH_HINT 0x0C53
 #define GL_PRIMITIVES_GENERATED 0x8C87
+#define GL_PRIMITIVES_SUBMITTED_ARB 0x82EF
 #define GL_PRIMITIVE_RESTART 0x8F9D
 #define GL_PRIMITIVE_RESTART_FIXED_INDEX 0x8D69
 #define GL_PRIMITIVE_RESTART_INDEX 0x8F9E
@@ -998,6 +1015,8 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
 #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
 #define GL_SYNC_STATUS 0x9114
+#define GL_TESS_CONTROL_SHADER_PATCHES_ARB 0x82F1
+#define GL_TESS_EVALUATION_SHADER_INVOCATIONS_ARB 0x82F2
 #define GL_TEXTURE 0x1702
 #define GL_TEXTURE0 0x84C0
 #define GL_TEXTURE1 0x84C1
@@ -1220,6 +1239,8 @@ typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apipro
 #define GL_VERTEX_ATTRIB_ARRAY_TYPE 0x8625
 #define GL_VERTEX_PROGRAM_POINT_SIZE 0x8642
 #define GL_VERTEX_SHADER 0x8B31
+#define GL_VERTEX_SHADER_INVOCATIONS_ARB 0x82F0
+#define GL_VERTICES_SUBMITTED_ARB 0x82EE
 #define GL_VIEWPORT 0x0BA2
 #define GL_WAIT_FAILED 0x911D
 #define GL_WRITE_ONLY 0x88B9
@@ -1320,6 +1341,8 @@ GLAD_API_CALL int GLAD_GL_VERSION_3_3;
 GLAD_API_CALL int GLAD_GL_ARB_ES2_compatibility;
 #define GL_ARB_ES3_compatibility 1
 GLAD_API_CALL int GLAD_GL_ARB_ES3_compatibility;
+#define GL_ARB_buffer_storage 1
+GLAD_API_CALL int GLAD_GL_ARB_buffer_storage;
 #define GL_ARB_clear_buffer_object 1
 GLAD_API_CALL int GLAD_GL_ARB_clear_buffer_object;
 #define GL_ARB_clear_texture 1
@@ -1328,10 +1351,18 @@ GLAD_API_CALL int GLAD_GL_ARB_clear_texture;
 GLAD_API_CALL int GLAD_GL_ARB_compute_shader;
 #define GL_ARB_debug_output 1
 GLAD_API_CALL int GLAD_GL_ARB_debug_output;
+#define GL_ARB_draw_indirect 1
+GLAD_API_CALL int GLAD_GL_ARB_draw_indirect;
 #define GL_ARB_get_texture_sub_image 1
 GLAD_API_CALL int GLAD_GL_ARB_get_texture_sub_image;
 #define GL_ARB_gl_spirv 1
 GLAD_API_CALL int GLAD_GL_ARB_gl_spirv;
+#define GL_ARB_indirect_parameters 1
+GLAD_API_CALL int GLAD_GL_ARB_indirect_parameters;
+#define GL_ARB_multi_draw_indirect 1
+GLAD_API_CALL int GLAD_GL_ARB_multi_draw_indirect;
+#define GL_ARB_pipeline_statistics_query 1
+GLAD_API_CALL int GLAD_GL_ARB_pipeline_statistics_query;
 #define GL_ARB_shader_atomic_counters 1
 GLAD_API_CALL int GLAD_GL_ARB_shader_atomic_counters;
 #define GL_ARB_shader_image_load_store 1
@@ -1386,6 +1417,7 @@ typedef void (GLAD_API_PTR *PFNGLBLENDFUNCPROC)(GLenum sfactor, GLenum dfactor);
 typedef void (GLAD_API_PTR *PFNGLBLENDFUNCSEPARATEPROC)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
 typedef void (GLAD_API_PTR *PFNGLBLITFRAMEBUFFERPROC)(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
 typedef void (GLAD_API_PTR *PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void * data, GLenum usage);
+typedef void (GLAD_API_PTR *PFNGLBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags);
 typedef void (GLAD_API_PTR *PFNGLBUFFERSUBDATAPROC)(GLenum target, GLintptr offset, GLsizeiptr size, const void * data);
 typedef GLenum (GLAD_API_PTR *PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
 typedef void (GLAD_API_PTR *PFNGLCLAMPCOLORPROC)(GLenum target, GLenum clamp);
@@ -1445,11 +1477,13 @@ typedef void (GLAD_API_PTR *PFNGLDISABLEIPROC)(GLenum target, GLuint index);
 typedef void (GLAD_API_PTR *PFNGLDISPATCHCOMPUTEPROC)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
 typedef void (GLAD_API_PTR *PFNGLDISPATCHCOMPUTEINDIRECTPROC)(GLintptr indirect);
 typedef void (GLAD_API_PTR *PFNGLDRAWARRAYSPROC)(GLenum mode, GLint first, GLsizei count);
+typedef void (GLAD_API_PTR *PFNGLDRAWARRAYSINDIRECTPROC)(GLenum mode, const void * indirect);
 typedef void (GLAD_API_PTR *PFNGLDRAWARRAYSINSTANCEDPROC)(GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
 typedef void (GLAD_API_PTR *PFNGLDRAWBUFFERPROC)(GLenum buf);
 typedef void (GLAD_API_PTR *PFNGLDRAWBUFFERSPROC)(GLsizei n, const GLenum * bufs);
 typedef void (GLAD_API_PTR *PFNGLDRAWELEMENTSPROC)(GLenum mode, GLsizei count, GLenum type, const void * indices);
 typedef void (GLAD_API_PTR *PFNGLDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLint basevertex);
+typedef void (GLAD_API_PTR *PFNGLDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void * indirect);
 typedef void (GLAD_API_PTR *PFNGLDRAWELEMENTSINSTANCEDPROC)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount);
 typedef void (GLAD_API_PTR *PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount, GLint basevertex);
 typedef void (GLAD_API_PTR *PFNGLDRAWRANGEELEMENTSPROC)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void * indices);
@@ -1568,8 +1602,12 @@ typedef void * (GLAD_API_PTR *PFNGLMAPBUFFERPROC)(GLenum target, GLenum access);
 typedef void * (GLAD_API_PTR *PFNGLMAPBUFFERRANGEPROC)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 typedef void (GLAD_API_PTR *PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
 typedef void (GLAD_API_PTR *PFNGLMULTIDRAWARRAYSPROC)(GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount);
+typedef void (GLAD_API_PTR *PFNGLMULTIDRAWARRAYSINDIRECTPROC)(GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride);
+typedef void (GLAD_API_PTR *PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)(GLenum mode, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
 typedef void (GLAD_API_PTR *PFNGLMULTIDRAWELEMENTSPROC)(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount);
 typedef void (GLAD_API_PTR *PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)(GLenum mode, const GLsizei * count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint * basevertex);
+typedef void (GLAD_API_PTR *PFNGLMULTIDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride);
+typedef void (GLAD_API_PTR *PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)(GLenum mode, GLenum type, const void * indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
 typedef void (GLAD_API_PTR *PFNGLPIXELSTOREFPROC)(GLenum pname, GLfloat param);
 typedef void (GLAD_API_PTR *PFNGLPIXELSTOREIPROC)(GLenum pname, GLint param);
 typedef void (GLAD_API_PTR *PFNGLPOINTPARAMETERFPROC)(GLenum pname, GLfloat param);
@@ -1783,6 +1821,8 @@ GLAD_API_CALL PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
 #define glBlitFramebuffer glad_glBlitFramebuffer
 GLAD_API_CALL PFNGLBUFFERDATAPROC glad_glBufferData;
 #define glBufferData glad_glBufferData
+GLAD_API_CALL PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+#define glBufferStorage glad_glBufferStorage
 GLAD_API_CALL PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
 #define glBufferSubData glad_glBufferSubData
 GLAD_API_CALL PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
@@ -1901,6 +1941,8 @@ GLAD_API_CALL PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect;
 #define glDispatchComputeIndirect glad_glDispatchComputeIndirect
 GLAD_API_CALL PFNGLDRAWARRAYSPROC glad_glDrawArrays;
 #define glDrawArrays glad_glDrawArrays
+GLAD_API_CALL PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect;
+#define glDrawArraysIndirect glad_glDrawArraysIndirect
 GLAD_API_CALL PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
 #define glDrawArraysInstanced glad_glDrawArraysInstanced
 GLAD_API_CALL PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
@@ -1911,6 +1953,8 @@ GLAD_API_CALL PFNGLDRAWELEMENTSPROC glad_glDrawElements;
 #define glDrawElements glad_glDrawElements
 GLAD_API_CALL PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
 #define glDrawElementsBaseVertex glad_glDrawElementsBaseVertex
+GLAD_API_CALL PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect;
+#define glDrawElementsIndirect glad_glDrawElementsIndirect
 GLAD_API_CALL PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
 #define glDrawElementsInstanced glad_glDrawElementsInstanced
 GLAD_API_CALL PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
@@ -2147,10 +2191,18 @@ GLAD_API_CALL PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier;
 #define glMemoryBarrier glad_glMemoryBarrier
 GLAD_API_CALL PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
 #define glMultiDrawArrays glad_glMultiDrawArrays
+GLAD_API_CALL PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect;
+#define glMultiDrawArraysIndirect glad_glMultiDrawArraysIndirect
+GLAD_API_CALL PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC glad_glMultiDrawArraysIndirectCountARB;
+#define glMultiDrawArraysIndirectCountARB glad_glMultiDrawArraysIndirectCountARB
 GLAD_API_CALL PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
 #define glMultiDrawElements glad_glMultiDrawElements
 GLAD_API_CALL PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
 #define glMultiDrawElementsBaseVertex glad_glMultiDrawElementsBaseVertex
+GLAD_API_CALL PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect;
+#define glMultiDrawElementsIndirect glad_glMultiDrawElementsIndirect
+GLAD_API_CALL PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC glad_glMultiDrawElementsIndirectCountARB;
+#define glMultiDrawElementsIndirectCountARB glad_glMultiDrawElementsIndirectCountARB
 GLAD_API_CALL PFNGLPIXELSTOREFPROC glad_glPixelStoref;
 #define glPixelStoref glad_glPixelStoref
 GLAD_API_CALL PFNGLPIXELSTOREIPROC glad_glPixelStorei;
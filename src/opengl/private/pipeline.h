@@ -14,8 +14,9 @@ GLenum toValue(GPUStencilMode mode);
 
 class GLContext;
 class GLProgram;
-class GLPipeline : GPUPipeline {
+class GLPipeline : public GPUPipeline {
     GLPipelineState m_state;
+    GLPipelineObject* m_object;
     GLState *m_ctx_state;
     GLContext* m_ctx;
 
@@ -60,6 +61,7 @@ class GLPipeline : GPUPipeline {
         void destroy() override;
         friend GLContext;
         friend GLState;
+        friend class GLDrawQueue;
 };
 
 #endif // OPENGL_PIPELINE_H
\ No newline at end of file
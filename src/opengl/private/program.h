@@ -16,6 +16,8 @@ typedef unsigned int GLbitfield;
 
 class GLProgram;
 class GLContext;
+class GLCommands;
+class GLState;
 class GLShader : public GPUShader {
     GLContext* m_ctx;
     GLuint m_shader;
@@ -71,6 +73,8 @@ class GLUniform : public GPUUniform {
         void destroy();
         friend GLProgram;
         friend GLContext;
+        friend GLCommands;
+        friend GLState;
 };
 
 // ------------------
@@ -84,7 +88,7 @@ enum class GLProgramStatus : int {
 };
 
 class GLProgram : public GPUProgram {
-    GPUHashmap<GLUniform*> m_uniforms;
+    GPUHashmap<GLUniform*, 12> m_uniforms;
     GLContext* m_ctx;
     GLProgramStatus m_status;
     GLuint m_program;
@@ -99,7 +103,9 @@ class GLProgram : public GPUProgram {
 
     // GPU Program Uniforms
     GPUUniform* createUniform(const char* label, GPUUniformType type) override;
+    GPUUniform* createUniform(GPUName label, GPUUniformType type) override;
     GPUUniform* getUniform(const char* label) override;
+    GPUUniform* getUniform(GPUName label) override;
     bool removeUniform(const char* label) override;
 
     protected: // OpenGL Program
@@ -108,6 +114,7 @@ class GLProgram : public GPUProgram {
         void attachShader(GPUShader *shader, GPUShaderType type, const char* msg);
         friend class GLState;
         friend GLContext;
+        friend GLCommands;
         friend GLUniform;
         friend GLShader;
 };
@@ -4,6 +4,7 @@
 #define OPENGL_STATE_H
 #include <nogpu/pipeline.h>
 #include <nogpu_map.h>
+#include <mutex>
 
 // ---------------------
 // OpenGL Pipeline State
@@ -45,6 +46,71 @@ typedef struct GLPipelineState {
     float line_width;
 } GLPipelineState;
 
+#define GL_PIPELINE_GROUPS 13
+typedef struct GLPipelineObject {
+    GLPipelineState state;
+    unsigned int groups[GL_PIPELINE_GROUPS];
+    unsigned long long hash;
+    // Interned Object Chain
+    struct GLPipelineObject* next;
+    unsigned int refs;
+} GLPipelineObject;
+
+// --------------------------
+// OpenGL Pipeline Transition
+// --------------------------
+
+enum class GLStateCall : unsigned int {
+    STATE_CALL_ENABLE,
+    STATE_CALL_DISABLE,
+    STATE_CALL_USE_PROGRAM,
+    STATE_CALL_BLEND_EQUATION,
+    STATE_CALL_BLEND_FUNC,
+    STATE_CALL_BLEND_COLOR,
+    STATE_CALL_CULL_FACE,
+    STATE_CALL_FRONT_FACE,
+    STATE_CALL_DEPTH_FUNC,
+    STATE_CALL_DEPTH_RANGE,
+    STATE_CALL_DEPTH_MASK,
+    STATE_CALL_POLYGON_OFFSET,
+    STATE_CALL_RESTART_INDEX,
+    STATE_CALL_STENCIL_FUNC,
+    STATE_CALL_STENCIL_MASK,
+    STATE_CALL_STENCIL_OP,
+    // OpenGL Viewport State
+    STATE_CALL_CLEAR_DEPTH,
+    STATE_CALL_CLEAR_STENCIL,
+    STATE_CALL_CLEAR_COLOR,
+    STATE_CALL_COLOR_MASK,
+    STATE_CALL_VIEWPORT,
+    STATE_CALL_SCISSOR,
+    STATE_CALL_LINE_WIDTH
+};
+
+typedef struct {
+    GLStateCall call;
+    union {
+        unsigned int u[4];
+        int i[4];
+        float f[4];
+    };
+} GLStateOp;
+
+#define GL_STATE_OPS_MAX 64
+typedef struct {
+    GLStateOp ops[GL_STATE_OPS_MAX];
+    int count;
+} GLStateOps;
+
+#define GL_PIPELINE_TRANSITIONS 64
+typedef struct {
+    GLPipelineObject* from;
+    GLPipelineObject* to;
+    GLStateOp* ops;
+    int count;
+    unsigned int tick;
+} GLPipelineTransition;
+
 // --------------------
 // OpenGL Command State
 // --------------------
@@ -64,24 +130,59 @@ class GLVertexArray;
 class GLBuffer;
 class GLTexture;
 class GLFrameBuffer;
+enum class GLCommandType : unsigned int;
+typedef struct {
+    GLBuffer* buffer;
+    unsigned int target;
+    unsigned int index;
+    int offset, size;
+    bool writable;
+} GLBlockBinding;
+
+typedef struct {
+    GLTexture* texture;
+    unsigned int unit;
+} GLTextureActive;
+
+class GLUniform;
+typedef struct {
+    GLTexture* texture;
+    GLUniform* sampler;
+} GLTextureSampler;
+
+typedef struct {
+    GLTexture* texture;
+    unsigned int tick;
+} GLTextureUnit;
+
 typedef struct GLCommandsState {
     GLPipeline *pipeline;
     GLVertexArray *vertex_array;
-    GPUHashmap<GLBuffer*> block_bindings;
-    GPUHashmap<GLTexture*> texture_actives;
+    GPUHashmap<GLBlockBinding, 8> block_bindings;
+    GPUHashmap<GLTextureActive, 8> texture_actives;
+    GPUHashmap<GLTextureSampler, 8> texture_samplers;
     GLFrameBuffer *framebuffer_draw;
     GLFrameBuffer *framebuffer_read;
 } GLCommandsState;
 
+typedef struct {
+    unsigned long long binds;
+    unsigned long long elided;
+    unsigned long long texture_hits;
+    unsigned long long texture_misses;
+    unsigned long long draws_recorded;
+    unsigned long long draws_issued;
+    unsigned long long barriers;
+} GLCommandsCounters;
+
+#define GL_HAZARD_BARRIERS 16
+
 // -------------------
 // OpenGL Global State
 // -------------------
 
 class GLState {
-    public: // OpenGL Capabilites
-        bool checkCapability(GPUPipelineCapability cap);
-        void enableCapability(GPUPipelineCapability cap);
-        void disableCapability(GPUPipelineCapability cap);
+    public: // OpenGL State: Effects
         bool resolveEffects();
 
     public: // OpenGL State: Pipeline
@@ -92,20 +193,88 @@ class GLState {
         void markPipelineEffect(GLPipelineEffect effect);
         void unmarkPipelineEffect(GLPipelineEffect effect);
         void checkPipelineEffects(GLPipelineState &check);
+        void checkPipelineObject(GLPipelineObject* object);
+
+    public: // OpenGL State: Pipeline Objects
+        GPUHashmap<GLPipelineObject*> m_pipeline_objects;
+        GLPipelineObject* m_pipeline_applied = nullptr;
+        GLPipelineObject* internPipelineState(GLPipelineState &state);
+        void releasePipelineState(GLPipelineObject* object);
+        void preparePipeline(GLPipeline* pipeline);
+
+    public: // OpenGL State: Pipeline Transitions
+        GLPipelineTransition m_pipeline_transitions[GL_PIPELINE_TRANSITIONS] {};
+        unsigned int m_pipeline_tick = 0;
+        GLPipelineTransition* findPipelineTransition(GLPipelineObject* from, GLPipelineObject* to);
+        void purgePipelineTransitions(GLPipelineObject* object);
+        void disposePipelineTransitions();
+        unsigned int diffPipelineObjects(GLPipelineObject* from, GLPipelineObject* to);
 
     public: // OpenGL State: Commands
         unsigned int m_stole_texture = 0;
         unsigned int m_commands_effects = 0;
+        unsigned int m_commands_clobber = 0;
         GLCommandsState m_commands_state {};
+        GLCommandsCounters m_commands_counters {};
         GLCommands* m_commands_current = nullptr;
         GLCommands* m_commands_cached = nullptr;
         void markCommandsEffect(GLCommandsEffect effect);
         void unmarkCommandsEffect(GLCommandsEffect effect);
+        void clobberCommandsEffect(GLCommandsEffect effect);
         void checkCommandsEffects(GLCommandsState &check);
+        void resolveCommandsEffects();
+        void resolveBakedBind(GLCommandType type, void* data);
+        // OpenGL State: Direct Binds
+        void clobberProgram();
+        void clobberVertexArray();
+        void clobberFrameBuffers();
+
+    public: // OpenGL State: Commands Bundles
+        static std::mutex m_bundles_mutex;
+        GLCommands* m_bundles = nullptr;
+        void linkBundle(GLCommands* bundle);
+        void unlinkBundle(GLCommands* bundle);
+        void invalidateBundles(void* object);
+
+    public: // OpenGL State: Texture Units
+        GLTextureUnit* m_texture_units = nullptr;
+        unsigned int m_texture_units_count = 0;
+        unsigned int m_texture_tick = 0;
+        void prepareTextureUnits(unsigned int count);
+        void disposeTextureUnits();
+        void residentTexture(GLTexture* texture, unsigned int unit);
+        void evictTexture(GLTexture* texture);
+
+    public: // OpenGL State: Indirect Buffers
+        GLBuffer* m_indirect_draw = nullptr;
+        GLBuffer* m_indirect_dispatch = nullptr;
+        GLBuffer* m_indirect_parameter = nullptr;
+        void bindIndirectBuffer(unsigned int target, GLBuffer* buffer);
+        void forgetIndirectBuffer(GLBuffer* buffer);
+
+    public: // OpenGL State: Memory Hazards
+        unsigned int m_hazard_tick = 0;
+        unsigned int m_hazard_pending = 0;
+        unsigned int m_hazard_barriers[GL_HAZARD_BARRIERS] {};
+        void hazardWrite(GLBuffer* buffer);
+        void hazardRead(GLBuffer* buffer, unsigned int barrier);
+        void hazardSync(GLBuffer* buffer, unsigned int barrier);
+        bool hazardWrites(GLCommandsState &check);
+        void resolveHazards(bool vertex);
+        void requestBarrier(unsigned int barrier);
+        void flushBarriers();
 
     private: // OpenGL State: Effects
-        void resolvePipelineEffect(GLPipelineEffect effect);
+        void compilePipelineEffect(GLStateOps &ops, GLPipelineState &state,
+            GLPipelineState &current, GLPipelineEffect effect);
+        void executeStateOps(GLStateOp* ops, int count);
         void resolvePipelineEffects();
+        void resolvePipelineTransition();
+        void resolveCommandsEffect(GLCommandsEffect effect);
+        void resolveBlockBinding(GLBlockBinding &binding);
+        void resolveTextureActive(GLTextureActive &active);
+        int resolveTextureUnit(GLTexture* texture);
+        void resolveTextureSamplers();
 };
 
 #endif // OPENGL_STATE_H
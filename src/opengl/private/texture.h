@@ -67,6 +67,7 @@ class GLTexture : virtual public GPUTexture {
         GLenum m_tex_target;
         GLuint m_tex_fbo;
         GLuint m_tex;
+        int m_tex_unit;
 
     protected: // Texture Compatible: Downloading
         void compatDownload3D(int x, int y, int z, int w, int h, int depth, int level, void* data);
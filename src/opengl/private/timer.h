@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#ifndef OPENGL_TIMER_H
+#define OPENGL_TIMER_H
+#include <nogpu/commands.h>
+
+typedef unsigned int GLuint;
+#define GL_TIMER_FRAMES 4
+#define GL_TIMER_DEPTH 32
+
+// ------------------------
+// OpenGL GPU Timer Queries
+// ------------------------
+
+typedef struct {
+    const char* label;
+    int depth, parent;
+    unsigned long long cpu_begin;
+    unsigned long long cpu_end;
+} GLTimerScope;
+
+typedef struct {
+    GLTimerScope* scopes;
+    int scopes_count;
+    int scopes_capacity;
+    // Timestamp Query Pairs
+    GLuint* queries;
+    GLuint last;
+    // CPU and GPU Clock Correlation
+    long long offset;
+    unsigned long long frame;
+    bool active, pending;
+} GLTimerFrame;
+
+class GLTimers {
+    GLTimerFrame m_frames[GL_TIMER_FRAMES] {};
+    int m_stack[GL_TIMER_DEPTH];
+    int m_stack_count = 0;
+    int m_current = 0;
+    unsigned long long m_frame = 0;
+    // Latest Resolved Table
+    GPUTimerScope* m_results = nullptr;
+    int m_results_capacity = 0;
+    GPUTimerTable m_table {};
+
+    void prepareFrame(GLTimerFrame* frame);
+    bool resolveFrame(GLTimerFrame* frame);
+
+    public: // Timer Scopes
+        void beginTimer(const char* label);
+        void endTimer();
+        void advanceTimers();
+        void disposeTimers();
+        GPUTimerTable getTable() { return m_table; }
+};
+
+#endif // OPENGL_TIMER_H
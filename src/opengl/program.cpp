@@ -6,10 +6,9 @@
 #include "private/glad.h"
 #include <cstdlib>
 
-GLProgram::GLProgram(GLContext* ctx) {
-    ctx->makeCurrent(this);
+GLProgram::GLProgram(GLContext* ctx) : m_uniforms(ctx->manipulateNames()) {
+    GPUTraceScope trace = ctx->makeCurrent(this);
     // Create OpenGL Program
-    m_uniforms = GPUHashmap<GLUniform*>();
     m_status = GLProgramStatus::STATUS_NONE;
     m_program = glCreateProgram();
     m_report = nullptr;
@@ -17,12 +16,13 @@ GLProgram::GLProgram(GLContext* ctx) {
 }
 
 void GLProgram::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     for (GLUniform* uniform : m_uniforms)
         uniform->destroy();
 
     // Destroy Object
     glUseProgram(0);
+    m_ctx->manipulateState()->clobberProgram();
     glDeleteProgram(m_program);
     delete this;
 }
@@ -32,7 +32,7 @@ void GLProgram::destroy() {
 // ----------------------
 
 void GLProgram::attachShader(GPUShader *shader, GPUShaderType type, const char* msg) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_status != GLProgramStatus::STATUS_NONE) {
         GPUReport::error("program is already compiled");
         return;
@@ -47,6 +47,7 @@ void GLProgram::attachShader(GPUShader *shader, GPUShaderType type, const char*
 
     // Attach Shader to Program
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     glAttachShader(m_program, s->m_shader);
 }
 
@@ -67,7 +68,7 @@ void GLProgram::attachCompute(GPUShader *compute) {
 // -------------------------------
 
 bool GLProgram::compileProgram() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     switch (m_status) {
         case GLProgramStatus::STATUS_NONE: break;
         case GLProgramStatus::STATUS_COMPILED: return true;
@@ -75,6 +76,7 @@ bool GLProgram::compileProgram() {
     }
 
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     glLinkProgram(m_program);
     // Check if Properly Compiled
     GLint status = GL_FALSE;
@@ -88,12 +90,13 @@ bool GLProgram::compileProgram() {
 }
 
 const char* GLProgram::compileReport() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_status != GLProgramStatus::STATUS_ERROR)
         return nullptr;
 
     // Get Program Status
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check Report Size
     GLint report_bytes = 0;
     glGetProgramiv(m_program, GL_INFO_LOG_LENGTH, &report_bytes);
@@ -114,19 +117,24 @@ const char* GLProgram::compileReport() {
 // -----------------------
 
 GPUUniform* GLProgram::createUniform(const char* label, GPUUniformType type) {
-    m_ctx->makeCurrent(this);
+    return this->createUniform(GPUName(label), type);
+}
+
+GPUUniform* GLProgram::createUniform(GPUName label, GPUUniformType type) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_status != GLProgramStatus::STATUS_COMPILED) {
         GPUReport::error("program is not compiled");
         return nullptr;
     }
 
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check Not yet Created
     GLUniform* uniform = nullptr;
     GLUniform** found = m_uniforms.get_name(label);
     if (found == nullptr) {
         bool check = false;
-        uniform = new GLUniform(this, type, label, check);
+        uniform = new GLUniform(this, type, label.name, check);
         if (check == false)
             return nullptr;
 
@@ -138,7 +146,7 @@ GPUUniform* GLProgram::createUniform(const char* label, GPUUniformType type) {
     // Check Collided Uniform
     uniform = *found;
     if (uniform->m_type != type) {
-        GPUReport::error("mismatch type with collided uniform: %s", label);
+        GPUReport::error("mismatch type with collided uniform: %s", label.name);
         return nullptr;
     }
 
@@ -147,16 +155,21 @@ GPUUniform* GLProgram::createUniform(const char* label, GPUUniformType type) {
 }
 
 GPUUniform* GLProgram::getUniform(const char* label) {
-    m_ctx->makeCurrent(this);
+    return this->getUniform(GPUName(label));
+}
+
+GPUUniform* GLProgram::getUniform(GPUName label) {
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_status != GLProgramStatus::STATUS_COMPILED) {
         GPUReport::error("program is not compiled");
         return nullptr;
     }
 
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     GLUniform** found = m_uniforms.get_name(label);
     if (found == nullptr) {
-        GPUReport::warning("uniform not found: %s", label);
+        GPUReport::warning("uniform not found: %s", label.name);
         return nullptr;
     }
 
@@ -165,13 +178,14 @@ GPUUniform* GLProgram::getUniform(const char* label) {
 }
 
 bool GLProgram::removeUniform(const char* label) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (m_status != GLProgramStatus::STATUS_COMPILED) {
         GPUReport::error("program is not compiled");
         return false;
     }
 
     glUseProgram(m_program);
+    m_ctx->manipulateState()->clobberProgram();
     GLUniform** found = m_uniforms.get_name(label);
     if (found == nullptr) {
         GPUReport::warning("uniform not found: %s", label);
@@ -28,7 +28,7 @@ static void compileShaderSPIR_V(GLuint shader, GPUShaderSource &data) {
 // -----------------------
 
 GLShader::GLShader(GLContext* ctx, GPUShaderType type, GPUShaderSource data) {
-    ctx->makeCurrent(this);
+    GPUTraceScope trace = ctx->makeCurrent(this);
     GLuint shader = 0;
 
     // Create Shader Object
@@ -66,7 +66,7 @@ GLShader::GLShader(GLContext* ctx, GPUShaderType type, GPUShaderSource data) {
 }
 
 void GLShader::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glDeleteShader(m_shader);
     if (m_report != nullptr)
         free(m_report);
@@ -80,7 +80,7 @@ void GLShader::destroy() {
 // --------------------
 
 bool GLShader::compileCheck() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     GLint shader_status = GL_FALSE;
 
     // Check Shader Compilation
@@ -89,7 +89,7 @@ bool GLShader::compileCheck() {
 }
 
 const char* GLShader::compileReport() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     if (compileCheck())
         return nullptr;
 
@@ -113,11 +113,11 @@ const char* GLShader::compileReport() {
 // -------------------------
 
 GPUShaderType GLShader::getType() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_type;
 }
 
 GPUShaderDriver GLShader::getDriver() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_driver;
 }
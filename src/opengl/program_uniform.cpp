@@ -7,7 +7,7 @@
 #include <cstring>
 
 GLUniform::GLUniform(GLProgram* program, GPUUniformType type, const char* name, bool &result) {
-    program->m_ctx->makeCurrent(this);
+    GPUTraceScope trace = program->m_ctx->makeCurrent(this);
     GLuint pro = program->m_program;
     GLuint uniform = GL_INVALID_INDEX;
     // Create Program Uniform
@@ -75,10 +75,12 @@ FAILED_UNIFORM:
 }
 
 void GLUniform::destroy() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Clear Shader Value
     memset(m_value, 0, sizeof(m_value));
     glUseProgram(m_program->m_program);
+    m_ctx->manipulateState()->clobberProgram();
+    m_ctx->manipulateState()->invalidateBundles(this);
     delete this;
 }
 
@@ -87,7 +89,7 @@ void GLUniform::destroy() {
 // ----------------------------------------
 
 void GLUniform::setValueRaw(void *data) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     const int bytes = computeUniformBytes(m_type);
     // Copy Value to Cache
     void* cache = (void*) m_value;
@@ -95,6 +97,7 @@ void GLUniform::setValueRaw(void *data) {
     GLuint program = m_program->m_program;
     GLuint uniform = m_uniform;
     glUseProgram(program);
+    m_ctx->manipulateState()->clobberProgram();
 
     // Copy Value to Shader
     switch (m_type) {
@@ -230,8 +233,9 @@ void GLUniform::setValueRaw(void *data) {
 // --------------------------------------
 
 void GLUniform::setValueBoolean(bool value) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glUseProgram(m_program->m_program);
+    m_ctx->manipulateState()->clobberProgram();
     GLint v = value;
 
     switch (m_type) {
@@ -249,8 +253,9 @@ void GLUniform::setValueBoolean(bool value) {
 }
 
 void GLUniform::setValueInteger(int value) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glUseProgram(m_program->m_program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check if is Uniform Integer
     if (m_type != GPUUniformType::UNIFORM_INT) {
         GPUReport::error("uniform is not UNIFORM_INT");
@@ -263,8 +268,9 @@ void GLUniform::setValueInteger(int value) {
 }
 
 void GLUniform::setValueFloat(float value) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glUseProgram(m_program->m_program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check if is Uniform Float
     if (m_type != GPUUniformType::UNIFORM_FLOAT) {
         GPUReport::error("uniform is not UNIFORM_FLOAT");
@@ -282,8 +288,9 @@ void GLUniform::setValueFloat(float value) {
 // ----------------------------------------
 
 void GLUniform::setTextureSampler(int index) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     glUseProgram(m_program->m_program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check if is Uniform Texture
     if (m_type != GPUUniformType::UNIFORM_TEXTURE_SAMPLER) {
         GPUReport::error("uniform is not UNIFORM_TEXTURE_SAMPLER");
@@ -297,9 +304,10 @@ void GLUniform::setTextureSampler(int index) {
 
 
 void GLUniform::setBlockIndex(int index, GPUUniformType type, const char* msg) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     GLuint program = m_program->m_program;
     glUseProgram(program);
+    m_ctx->manipulateState()->clobberProgram();
     // Check if is Uniform Block
     if (m_type != type) {
         GPUReport::error("%s", msg);
@@ -331,23 +339,23 @@ void GLUniform::setBlockAtomicCounter(int index) {
 // ---------------------------------
 
 GPUProgram* GLUniform::getProgram() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_program;
 }
 
 GPUUniformType GLUniform::getType() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return m_type;
 }
 
 void GLUniform::getValue(void *output) {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     // Copy Value Data to Destination
     const int bytes = computeUniformBytes(m_type);
     memcpy(output, m_value, bytes);
 }
 
 int GLUniform::getBytes() {
-    m_ctx->makeCurrent(this);
+    GPUTraceScope trace = m_ctx->makeCurrent(this);
     return computeUniformBytes(m_type);
 }
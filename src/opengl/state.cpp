@@ -1,119 +1,10 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
 #include "private/state.hpp"
 #include "private/glad.h"
 #include <cstring>
 
-bool GLState::checkCapability(GPUPipelineCapability cap) {
-    return (m_pipeline_state.capabilities & (1 << static_cast<unsigned int>(cap))) != 0;
-}
-
-void GLState::enableCapability(GPUPipelineCapability cap) {
-    GLPipelineState *state = &m_pipeline_state;
-    // Avoid Already Enabled
-    unsigned int flag = 1 << static_cast<unsigned int>(cap);
-    if (flag & state->capabilities)
-        return;
-
-    switch (cap) {
-        case GPUPipelineCapability::CAPABILITY_BLENDING:
-            glEnable(GL_BLEND);
-            break;
-        case GPUPipelineCapability::CAPABILITY_CULLING:
-            glEnable(GL_CULL_FACE);
-            break;
-
-        case GPUPipelineCapability::CAPABILITY_DEPTH:
-            glEnable(GL_DEPTH_TEST);
-            break;
-        case GPUPipelineCapability::CAPABILITY_DEPTH_OFFSET:
-            glEnable(GL_POLYGON_OFFSET_FILL);
-            glEnable(GL_POLYGON_OFFSET_LINE);
-            glEnable(GL_POLYGON_OFFSET_POINT);
-            break;
-        case GPUPipelineCapability::CAPABILITY_DEPTH_READ_ONLY:
-            glDepthMask(GL_FALSE);
-            break;
-        case GPUPipelineCapability::CAPABILITY_STENCIL:
-            glEnable(GL_STENCIL_TEST);
-            break;
-        case GPUPipelineCapability::CAPABILITY_SCISSOR:
-            glEnable(GL_SCISSOR_TEST);
-            break;
-
-        case GPUPipelineCapability::CAPABILITY_PRIMITIVE_RESTART:
-            if (GLAD_GL_ARB_ES3_compatibility) {
-                glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
-            } else if (glPrimitiveRestartIndex != nullptr) {
-                glEnable(GL_PRIMITIVE_RESTART);
-                glPrimitiveRestartIndex(0xFFFFFFFF);
-            }
-
-            break;
-        case GPUPipelineCapability::CAPABILITY_RASTERIZE_DISCARD:
-            glEnable(GL_RASTERIZER_DISCARD);
-            break;
-        case GPUPipelineCapability::CAPABILITY_MULTISAMPLE:
-            glEnable(GL_MULTISAMPLE);
-            break;
-    }
-
-    // Enable Flag to State
-    state->capabilities |= flag;
-}
-
-void GLState::disableCapability(GPUPipelineCapability cap) {
-    GLPipelineState *state = &m_pipeline_state;
-    // Avoid Already Disabled
-    unsigned int flag = 1 << static_cast<unsigned int>(cap);
-    if ((flag & state->capabilities) == 0)
-        return;
-
-    switch (cap) {
-        case GPUPipelineCapability::CAPABILITY_BLENDING:
-            glDisable(GL_BLEND);
-            break;
-        case GPUPipelineCapability::CAPABILITY_CULLING:
-            glDisable(GL_CULL_FACE);
-            break;
-
-        case GPUPipelineCapability::CAPABILITY_DEPTH:
-            glDisable(GL_DEPTH_TEST);
-            break;
-        case GPUPipelineCapability::CAPABILITY_DEPTH_OFFSET:
-            glDisable(GL_POLYGON_OFFSET_FILL);
-            glDisable(GL_POLYGON_OFFSET_LINE);
-            glDisable(GL_POLYGON_OFFSET_POINT);
-            break;
-        case GPUPipelineCapability::CAPABILITY_DEPTH_READ_ONLY:
-            glDepthMask(GL_TRUE);
-            break;
-        case GPUPipelineCapability::CAPABILITY_STENCIL:
-            glDisable(GL_STENCIL_TEST);
-            break;
-        case GPUPipelineCapability::CAPABILITY_SCISSOR:
-            glDisable(GL_SCISSOR_TEST);
-            break;
-
-        case GPUPipelineCapability::CAPABILITY_PRIMITIVE_RESTART:
-            if (GLAD_GL_ARB_ES3_compatibility)
-                glDisable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
-            else if (glPrimitiveRestartIndex != nullptr)
-                glDisable(GL_PRIMITIVE_RESTART);
-
-            break;
-        case GPUPipelineCapability::CAPABILITY_RASTERIZE_DISCARD:
-            glDisable(GL_RASTERIZER_DISCARD);
-            break;
-        case GPUPipelineCapability::CAPABILITY_MULTISAMPLE:
-            glDisable(GL_MULTISAMPLE);
-            break;
-    }
-
-    // Disable Flag to State
-    state->capabilities &= ~flag;
-}
-
 // ------------------------------
 // OpenGL State: Pipeline Effects
 // ------------------------------
@@ -171,6 +62,54 @@ void GLState::unmarkCommandsEffect(GLCommandsEffect effect) {
     m_commands_effects &= ~(1 << static_cast<unsigned int>(effect));
 }
 
+void GLState::clobberCommandsEffect(GLCommandsEffect effect) {
+    m_commands_clobber |= 1 << static_cast<unsigned int>(effect);
+    m_commands_effects |= 1 << static_cast<unsigned int>(effect);
+}
+
+void GLState::clobberProgram() {
+    m_pipeline_state.program = nullptr;
+    m_pipeline_applied = nullptr;
+    markPipelineEffect(GLPipelineEffect::PIPELINE_EFFECT_PROGRAM);
+}
+
+void GLState::clobberVertexArray() {
+    clobberCommandsEffect(GLCommandsEffect::CMD_EFFECT_VERTEX_ARRAY);
+}
+
+void GLState::clobberFrameBuffers() {
+    clobberCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_DRAW);
+    clobberCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_READ);
+}
+
 void GLState::checkCommandsEffects(GLCommandsState &check) {
+    GLCommandsState *state = &m_commands_state;
+
+    if (m_pipeline_current != check.pipeline)
+        markCommandsEffect(GLCommandsEffect::CMD_EFFECT_PIPELINE);
+    if (state->vertex_array != check.vertex_array)
+        markCommandsEffect(GLCommandsEffect::CMD_EFFECT_VERTEX_ARRAY);
+    if (state->framebuffer_draw != check.framebuffer_draw)
+        markCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_DRAW);
+    if (state->framebuffer_read != check.framebuffer_read)
+        markCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_READ);
+
+    // Check Block Bindings Changes
+    for (GLBlockBinding binding : check.block_bindings) {
+        unsigned int key = (binding.target << 16) | binding.index;
+        GLBlockBinding* found = state->block_bindings.get_key(key);
+        if (!found || memcmp(found, &binding, sizeof(GLBlockBinding)) != 0) {
+            markCommandsEffect(GLCommandsEffect::CMD_EFFECT_BLOCK_BINDING);
+            break;
+        }
+    }
 
+    // Check Texture Units Changes
+    for (GLTextureActive active : check.texture_actives) {
+        GLTextureActive* found = state->texture_actives.get_key(active.unit);
+        if (!found || found->texture != active.texture) {
+            markCommandsEffect(GLCommandsEffect::CMD_EFFECT_TEXTURE_ACTIVE);
+            break;
+        }
+    }
 }
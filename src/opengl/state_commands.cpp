@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/pipeline.h"
+#include "private/framebuffer.h"
+#include "private/texture.h"
+#include "private/glad.h"
+#include <cstring>
+
+void GLState::resolveBlockBinding(GLBlockBinding &binding) {
+    GLCommandsState* state = &m_commands_state;
+    GLCommandsCounters* counters = &m_commands_counters;
+    unsigned int key = (binding.target << 16) | binding.index;
+    GLBlockBinding* found = state->block_bindings.get_key(key);
+    if (found && memcmp(found, &binding, sizeof(GLBlockBinding)) == 0) {
+        counters->elided++;
+        return;
+    }
+
+    // Bind Buffer Range or Whole Buffer
+    GLuint vbo = (binding.buffer) ? binding.buffer->m_vbo : 0;
+    if (binding.size > 0)
+        glBindBufferRange(binding.target, binding.index, vbo, binding.offset, binding.size);
+    else glBindBufferBase(binding.target, binding.index, vbo);
+    state->block_bindings.replace_key(key, binding);
+    counters->binds++;
+}
+
+void GLState::resolveTextureActive(GLTextureActive &active) {
+    GLCommandsState* state = &m_commands_state;
+    GLCommandsCounters* counters = &m_commands_counters;
+    GLTextureActive* found = state->texture_actives.get_key(active.unit);
+    if (found && found->texture == active.texture) {
+        counters->elided++;
+        return;
+    }
+
+    // Bind Texture to Texture Unit
+    GLTexture* texture = active.texture;
+    glActiveTexture(GL_TEXTURE0 + active.unit);
+    glBindTexture(texture->m_tex_target, texture->m_tex);
+    state->texture_actives.replace_key(active.unit, active);
+    residentTexture(texture, active.unit);
+    counters->binds++;
+}
+
+void GLState::resolveCommandsEffect(GLCommandsEffect effect) {
+    GLCommandsState* state = &m_commands_state;
+    GLCommandsState* current = &m_commands_current->m_state;
+    GLCommandsCounters* counters = &m_commands_counters;
+    // Check if Effect State is Unknown
+    unsigned int flag = 1 << static_cast<unsigned int>(effect);
+    bool clobber = (m_commands_clobber & flag) != 0;
+
+    switch (effect) {
+        case GLCommandsEffect::CMD_EFFECT_PIPELINE: {
+            GLPipeline* pipeline = current->pipeline;
+            if (pipeline == m_pipeline_current) {
+                counters->elided++;
+                break;
+            }
+
+            // Diff Pipeline Against Applied Object
+            m_pipeline_current = pipeline;
+            if (pipeline != nullptr) {
+                preparePipeline(pipeline);
+                checkPipelineObject(pipeline->m_object);
+            }
+
+            state->pipeline = pipeline;
+        } break;
+
+        case GLCommandsEffect::CMD_EFFECT_VERTEX_ARRAY: {
+            GLVertexArray* vao = current->vertex_array;
+            if (!clobber && state->vertex_array == vao) {
+                counters->elided++;
+                break;
+            }
+
+            // Bind Vertex Array Object
+            glBindVertexArray((vao) ? vao->m_vao : 0);
+            state->vertex_array = vao;
+            counters->binds++;
+        } break;
+
+        case GLCommandsEffect::CMD_EFFECT_BLOCK_BINDING: {
+            if (clobber)
+                state->block_bindings = GPUHashmap<GLBlockBinding, 8>();
+
+            for (GLBlockBinding binding : current->block_bindings)
+                resolveBlockBinding(binding);
+        } break;
+
+        case GLCommandsEffect::CMD_EFFECT_TEXTURE_ACTIVE: {
+            if (clobber)
+                state->texture_actives = GPUHashmap<GLTextureActive, 8>();
+
+            for (GLTextureActive active : current->texture_actives)
+                resolveTextureActive(active);
+        } break;
+
+        case GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_DRAW: {
+            GLFrameBuffer* fbo = current->framebuffer_draw;
+            if (!clobber && state->framebuffer_draw == fbo) {
+                counters->elided++;
+                break;
+            }
+
+            // Bind Draw Framebuffer
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, (fbo) ? fbo->m_fbo : 0);
+            state->framebuffer_draw = fbo;
+            counters->binds++;
+        } break;
+
+        case GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_READ: {
+            GLFrameBuffer* fbo = current->framebuffer_read;
+            if (!clobber && state->framebuffer_read == fbo) {
+                counters->elided++;
+                break;
+            }
+
+            // Bind Read Framebuffer
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, (fbo) ? fbo->m_fbo : 0);
+            state->framebuffer_read = fbo;
+            counters->binds++;
+        } break;
+    }
+}
+
+void GLState::resolveCommandsEffects() {
+    if (m_commands_effects == 0)
+        return;
+
+    // Resolve Commands Flags
+    unsigned int effects = m_commands_effects;
+    while (effects != 0) {
+        unsigned int index = __builtin_ctz(effects);
+        GLCommandsEffect effect = static_cast<GLCommandsEffect>(index);
+        resolveCommandsEffect(effect);
+        effects &= ~(1 << index);
+    }
+
+    // Replace Commands Effects
+    m_commands_effects = effects;
+    m_commands_clobber = 0;
+}
+
+// --------------------------------
+// OpenGL State: Bundle Baked Binds
+// --------------------------------
+
+void GLState::resolveBakedBind(GLCommandType type, void* data) {
+    GLCommandsState* current = &m_commands_current->m_state;
+    GLCommandObject* use = (GLCommandObject*) data;
+
+    switch (type) {
+        case GLCommandType::CMD_BAKED_PIPELINE:
+            current->pipeline = use->pipeline;
+            resolveCommandsEffect(GLCommandsEffect::CMD_EFFECT_PIPELINE);
+            break;
+        case GLCommandType::CMD_BAKED_VERTEX_ARRAY:
+            current->vertex_array = use->vertex_array;
+            resolveCommandsEffect(GLCommandsEffect::CMD_EFFECT_VERTEX_ARRAY);
+            break;
+        case GLCommandType::CMD_BAKED_FRAMEBUFFER_DRAW:
+            current->framebuffer_draw = use->framebuffer;
+            resolveCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_DRAW);
+            break;
+        case GLCommandType::CMD_BAKED_FRAMEBUFFER_READ:
+            current->framebuffer_read = use->framebuffer;
+            resolveCommandsEffect(GLCommandsEffect::CMD_EFFECT_FRAMEBUFFER_READ);
+            break;
+
+        case GLCommandType::CMD_BAKED_BLOCK_BINDING: {
+            GLBlockBinding* binding = (GLBlockBinding*) data;
+            unsigned int key = (binding->target << 16) | binding->index;
+            current->block_bindings.replace_key(key, *binding);
+            resolveBlockBinding(*binding);
+        } break;
+
+        case GLCommandType::CMD_BAKED_TEXTURE: {
+            GLTextureActive* active = (GLTextureActive*) data;
+            // Removed Units are Only Forgotten
+            if (active->texture == nullptr) {
+                current->texture_actives.remove_key(active->unit);
+                break;
+            }
+
+            current->texture_actives.replace_key(active->unit, *active);
+            resolveTextureActive(*active);
+        } break;
+
+        // Not a Baked Bind
+        default: break;
+    }
+}
+
+// ---------------------------
+// OpenGL State: Effects Apply
+// ---------------------------
+
+bool GLState::resolveEffects() {
+    if (m_commands_current == nullptr) {
+        GPUReport::error("commands are not being recorded");
+        return false;
+    }
+
+    // Resolve Commands and Pipeline
+    resolveCommandsEffects();
+    if (m_pipeline_current == nullptr) {
+        GPUReport::error("pipeline is not used by commands");
+        return false;
+    }
+
+    // Pipeline State Changed After Use
+    GLPipeline* pipeline = m_pipeline_current;
+    if (pipeline->m_object == nullptr) {
+        preparePipeline(pipeline);
+        checkPipelineObject(pipeline->m_object);
+    }
+
+    resolvePipelineTransition();
+    m_pipeline_applied = pipeline->m_object;
+    // Resolve Samplers with Program Bound
+    if (m_commands_current->m_state.texture_samplers.count() > 0)
+        resolveTextureSamplers();
+    return true;
+}
+
+// ------------------------------
+// OpenGL State: Commands Bundles
+// ------------------------------
+
+// Bundles are Baked on Worker Threads
+std::mutex GLState::m_bundles_mutex;
+
+void GLState::linkBundle(GLCommands* bundle) {
+    // Caller Holds Lock while Baking
+    if (bundle->m_bundle_linked)
+        return;
+
+    // Track Bundle for Invalidation
+    bundle->m_bundle_next = m_bundles;
+    bundle->m_bundle_linked = true;
+    m_bundles = bundle;
+}
+
+void GLState::unlinkBundle(GLCommands* bundle) {
+    std::lock_guard<std::mutex> lock(m_bundles_mutex);
+    GLCommands** link = &m_bundles;
+    while (*link != nullptr && *link != bundle)
+        link = &(*link)->m_bundle_next;
+
+    // Remove Bundle from List
+    if (*link != nullptr)
+        *link = bundle->m_bundle_next;
+    bundle->m_bundle_next = nullptr;
+    bundle->m_bundle_linked = false;
+}
+
+void GLState::invalidateBundles(void* object) {
+    std::lock_guard<std::mutex> lock(m_bundles_mutex);
+    for (GLCommands* bundle = m_bundles; bundle != nullptr; bundle = bundle->m_bundle_next)
+        if (bundle->m_bundle_valid && bundle->checkBundle(object))
+            bundle->m_bundle_valid = false;
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/buffer.h"
+#include "private/state.hpp"
+#include "private/glad.h"
+
+static int hazardIndex(unsigned int barrier) {
+    int index = 0;
+    while (index < GL_HAZARD_BARRIERS && (barrier & (1u << index)) == 0)
+        index++;
+    return index;
+}
+
+void GLState::hazardWrite(GLBuffer* buffer) {
+    if (buffer == nullptr)
+        return;
+
+    // Stamp Incoherent Shader Write
+    buffer->m_hazard_tick = ++m_hazard_tick;
+}
+
+void GLState::hazardRead(GLBuffer* buffer, unsigned int barrier) {
+    if (buffer == nullptr || buffer->m_hazard_tick == 0)
+        return;
+
+    // Check Write was Made Visible for Usage
+    int index = hazardIndex(barrier);
+    if (index < GL_HAZARD_BARRIERS && buffer->m_hazard_tick > m_hazard_barriers[index])
+        m_hazard_pending |= barrier;
+}
+
+void GLState::hazardSync(GLBuffer* buffer, unsigned int barrier) {
+    hazardRead(buffer, barrier);
+    flushBarriers();
+}
+
+// ---------------------------------
+// OpenGL State: Memory Hazard Check
+// ---------------------------------
+
+static unsigned int hazardBarrier(unsigned int target) {
+    switch (target) {
+        case GL_UNIFORM_BUFFER: return GL_UNIFORM_BARRIER_BIT;
+        case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BARRIER_BIT;
+        case GL_ATOMIC_COUNTER_BUFFER: return GL_ATOMIC_COUNTER_BARRIER_BIT;
+        default: return 0;
+    }
+}
+
+void GLState::resolveHazards(bool vertex) {
+    GLCommandsState* current = &m_commands_state;
+    // Check Vertex Fetch Reads
+    GLVertexArray* vao = current->vertex_array;
+    if (vertex && vao != nullptr) {
+        hazardRead(static_cast<GLBuffer*>(vao->getArrayBuffer()),
+            GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+        hazardRead(static_cast<GLBuffer*>(vao->getElementsBuffer()),
+            GL_ELEMENT_ARRAY_BARRIER_BIT);
+    }
+
+    // Check Block Binding Reads
+    for (GLBlockBinding binding : current->block_bindings)
+        hazardRead(binding.buffer, hazardBarrier(binding.target));
+    flushBarriers();
+
+    // Storage Blocks may be Written by Shaders
+    for (GLBlockBinding binding : current->block_bindings)
+        if (binding.writable)
+            hazardWrite(binding.buffer);
+}
+
+bool GLState::hazardWrites(GLCommandsState &check) {
+    // Shader Writes Need a Barrier between Draws
+    for (GLBlockBinding binding : check.block_bindings)
+        if (binding.writable)
+            return true;
+
+    return false;
+}
+
+// ----------------------------------
+// OpenGL State: Memory Barrier Merge
+// ----------------------------------
+
+void GLState::requestBarrier(unsigned int barrier) {
+    m_hazard_pending |= barrier;
+}
+
+void GLState::flushBarriers() {
+    unsigned int pending = m_hazard_pending;
+    if (pending == 0)
+        return;
+
+    // Issue One Merged Barrier
+    m_hazard_pending = 0;
+    if (glMemoryBarrier == nullptr)
+        return;
+    glMemoryBarrier(pending);
+    m_commands_counters.barriers++;
+
+    // Previous Writes are Visible for Barrier Usages
+    for (int i = 0; i < GL_HAZARD_BARRIERS; i++)
+        if (pending & (1u << i))
+            m_hazard_barriers[i] = m_hazard_tick;
+}
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/buffer.h"
+#include "private/state.hpp"
+#include "private/glad.h"
+
+static GLBuffer** indirectSlot(GLState* state, unsigned int target) {
+    switch (target) {
+        case GL_DRAW_INDIRECT_BUFFER: return &state->m_indirect_draw;
+        case GL_DISPATCH_INDIRECT_BUFFER: return &state->m_indirect_dispatch;
+        case GL_PARAMETER_BUFFER_ARB: return &state->m_indirect_parameter;
+        default: return nullptr;
+    }
+}
+
+void GLState::bindIndirectBuffer(unsigned int target, GLBuffer* buffer) {
+    GLBuffer** slot = indirectSlot(this, target);
+    if (slot == nullptr)
+        return;
+
+    // Avoid Rebinding Same Indirect Buffer
+    if (*slot == buffer) {
+        m_commands_counters.elided++;
+        return;
+    }
+
+    glBindBuffer(target, buffer->m_vbo);
+    m_commands_counters.binds++;
+    *slot = buffer;
+}
+
+void GLState::forgetIndirectBuffer(GLBuffer* buffer) {
+    // Deleted Buffers are Unbound by OpenGL
+    if (m_indirect_draw == buffer)
+        m_indirect_draw = nullptr;
+    if (m_indirect_dispatch == buffer)
+        m_indirect_dispatch = nullptr;
+    if (m_indirect_parameter == buffer)
+        m_indirect_parameter = nullptr;
+}
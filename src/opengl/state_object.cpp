@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include "private/state.hpp"
+#include "private/pipeline.h"
+#include <cstdlib>
+#include <cstring>
+
+static const void* groupData(GLPipelineState* state, int group, int &bytes) {
+    switch (static_cast<GLPipelineEffect>(group)) {
+        case GLPipelineEffect::PIPELINE_EFFECT_CAPABILITIES:
+            bytes = sizeof(state->capabilities); return &state->capabilities;
+        case GLPipelineEffect::PIPELINE_EFFECT_PROGRAM:
+            bytes = sizeof(state->program); return &state->program;
+        case GLPipelineEffect::PIPELINE_EFFECT_BLENDING:
+            bytes = sizeof(state->blending); return &state->blending;
+        case GLPipelineEffect::PIPELINE_EFFECT_CULLING:
+            bytes = sizeof(state->culling); return &state->culling;
+        case GLPipelineEffect::PIPELINE_EFFECT_DEPTH:
+            bytes = sizeof(state->depth); return &state->depth;
+        case GLPipelineEffect::PIPELINE_EFFECT_STENCIL:
+            bytes = sizeof(state->stencil); return &state->stencil;
+
+        // OpenGL Viewport State
+        case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_DEPTH:
+            bytes = sizeof(state->clear_depth); return &state->clear_depth;
+        case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_STENCIL:
+            bytes = sizeof(state->clear_stencil); return &state->clear_stencil;
+        case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_COLOR:
+            bytes = sizeof(state->clear_color); return &state->clear_color;
+        case GLPipelineEffect::PIPELINE_EFFECT_COLOR_MASK:
+            bytes = sizeof(state->color_mask); return &state->color_mask;
+        case GLPipelineEffect::PIPELINE_EFFECT_VIEWPORT:
+            bytes = sizeof(state->viewport); return &state->viewport;
+        case GLPipelineEffect::PIPELINE_EFFECT_SCISSOR:
+            bytes = sizeof(state->scissor); return &state->scissor;
+        case GLPipelineEffect::PIPELINE_EFFECT_LINE_WIDTH:
+            bytes = sizeof(state->line_width); return &state->line_width;
+    }
+
+    // Unreachable Group
+    bytes = 0;
+    return nullptr;
+}
+
+static unsigned int groupHash(const void* data, int bytes) {
+    const unsigned char* src = (const unsigned char*) data;
+    unsigned int hash = 2166136261u;
+    // FNV-1a Hash
+    for (int i = 0; i < bytes; i++) {
+        hash ^= src[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// -------------------------------
+// OpenGL Pipeline Object: Prepare
+// -------------------------------
+
+static bool checkFlag(unsigned int caps, GPUPipelineCapability cap) {
+    return (caps & (1 << static_cast<unsigned int>(cap))) != 0;
+}
+
+static void canonicalState(GLPipelineState &dst, GLPipelineState &src) {
+    memset(&dst, 0, sizeof(GLPipelineState));
+    unsigned int caps = src.capabilities;
+    dst.capabilities = caps;
+    dst.program = src.program;
+    dst.depth = src.depth;
+
+    // Winding Affects gl_FrontFacing, Stencil Mask Affects Clear
+    dst.culling.winding = src.culling.winding;
+    dst.stencil.mask = src.stencil.mask;
+
+    // Disabled Capabilities Have no Visible State
+    if (checkFlag(caps, GPUPipelineCapability::CAPABILITY_BLENDING))
+        dst.blending = src.blending;
+    if (checkFlag(caps, GPUPipelineCapability::CAPABILITY_CULLING))
+        dst.culling.mode = src.culling.mode;
+    if (checkFlag(caps, GPUPipelineCapability::CAPABILITY_STENCIL)) {
+        dst.stencil.function = src.stencil.function;
+        dst.stencil.mode = src.stencil.mode;
+    }
+    if (checkFlag(caps, GPUPipelineCapability::CAPABILITY_SCISSOR))
+        dst.scissor = src.scissor;
+
+    // OpenGL Viewport State
+    dst.clear_depth = src.clear_depth;
+    dst.clear_stencil = src.clear_stencil;
+    dst.clear_color = src.clear_color;
+    dst.color_mask = src.color_mask;
+    dst.viewport = src.viewport;
+    dst.line_width = src.line_width;
+}
+
+static void prepareObject(GLPipelineObject &object, GLPipelineState &state) {
+    canonicalState(object.state, state);
+    unsigned long long hash = 14695981039346656037ull;
+    // Hash Each Effect Group
+    for (int i = 0; i < GL_PIPELINE_GROUPS; i++) {
+        int bytes = 0;
+        const void* data = groupData(&object.state, i, bytes);
+        unsigned int group = groupHash(data, bytes);
+        object.groups[i] = group;
+        // Combine Group Hashes
+        hash ^= group;
+        hash *= 1099511628211ull;
+    }
+
+    object.hash = hash;
+    object.next = nullptr;
+    object.refs = 0;
+}
+
+static unsigned int objectKey(unsigned long long hash) {
+    return (unsigned int) (hash ^ (hash >> 32));
+}
+
+// ------------------------------
+// OpenGL Pipeline Object: Intern
+// ------------------------------
+
+GLPipelineObject* GLState::internPipelineState(GLPipelineState &state) {
+    GLPipelineObject check;
+    prepareObject(check, state);
+    unsigned int key = objectKey(check.hash);
+    GLPipelineObject** head = m_pipeline_objects.get_key(key);
+
+    // Find Identical Pipeline Object
+    GLPipelineObject* object = (head) ? *head : nullptr;
+    for (; object != nullptr; object = object->next) {
+        if (object->hash == check.hash &&
+            memcmp(&object->state, &check.state, sizeof(GLPipelineState)) == 0) {
+                object->refs++;
+                return object;
+            }
+    }
+
+    // Allocate New Pipeline Object
+    object = (GLPipelineObject*) malloc(sizeof(GLPipelineObject));
+    *object = check;
+    object->refs = 1;
+    object->next = (head) ? *head : nullptr;
+    m_pipeline_objects.replace_key(key, object);
+    return object;
+}
+
+void GLState::releasePipelineState(GLPipelineObject* object) {
+    if (--object->refs > 0)
+        return;
+
+    // Forget Applied Object and Transitions
+    if (m_pipeline_applied == object)
+        m_pipeline_applied = nullptr;
+    purgePipelineTransitions(object);
+
+    // Unlink Object from Chain
+    unsigned int key = objectKey(object->hash);
+    GLPipelineObject** head = m_pipeline_objects.get_key(key);
+    GLPipelineObject** link = head;
+    while (*link != object)
+        link = &(*link)->next;
+    *link = object->next;
+
+    // Remove Empty Chain
+    if (*head == nullptr)
+        m_pipeline_objects.remove_key(key);
+    free(object);
+}
+
+void GLState::preparePipeline(GLPipeline* pipeline) {
+    if (pipeline->m_object == nullptr)
+        pipeline->m_object = internPipelineState(pipeline->m_state);
+}
+
+// -----------------------------
+// OpenGL Pipeline Object: Check
+// -----------------------------
+
+unsigned int GLState::diffPipelineObjects(GLPipelineObject* from, GLPipelineObject* to) {
+    unsigned int effects = 0;
+    for (int i = 0; i < GL_PIPELINE_GROUPS; i++) {
+        if (from->groups[i] != to->groups[i]) {
+            effects |= 1 << i;
+            continue;
+        }
+
+        // Confirm Equal Hashes to Avoid Collisions
+        int bytes = 0;
+        const void* data0 = groupData(&from->state, i, bytes);
+        const void* data1 = groupData(&to->state, i, bytes);
+        if (memcmp(data0, data1, bytes) != 0)
+            effects |= 1 << i;
+    }
+
+    return effects;
+}
+
+void GLState::checkPipelineObject(GLPipelineObject* object) {
+    // Applied Objects are Resolved as Transitions
+    if (m_pipeline_applied == nullptr)
+        checkPipelineEffects(object->state);
+}
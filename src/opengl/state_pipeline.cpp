@@ -7,9 +7,71 @@
 #include "private/glad.h"
 #include <cstring>
 
-void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
-    GLPipelineState* state = &m_pipeline_state;
-    GLPipelineState* current = &m_pipeline_current->m_state;
+static GLStateOp* emitOp(GLStateOps &ops, GLStateCall call) {
+    GLStateOp* op = &ops.ops[ops.count++];
+    op->call = call;
+    return op;
+}
+
+static void emitCapability(GLStateOps &ops, GPUPipelineCapability cap, bool enable) {
+    GLStateCall call = (enable) ?
+        GLStateCall::STATE_CALL_ENABLE :
+        GLStateCall::STATE_CALL_DISABLE;
+
+    switch (cap) {
+        case GPUPipelineCapability::CAPABILITY_BLENDING:
+            emitOp(ops, call)->u[0] = GL_BLEND;
+            break;
+        case GPUPipelineCapability::CAPABILITY_CULLING:
+            emitOp(ops, call)->u[0] = GL_CULL_FACE;
+            break;
+
+        case GPUPipelineCapability::CAPABILITY_DEPTH:
+            emitOp(ops, call)->u[0] = GL_DEPTH_TEST;
+            break;
+        case GPUPipelineCapability::CAPABILITY_DEPTH_OFFSET:
+            emitOp(ops, call)->u[0] = GL_POLYGON_OFFSET_FILL;
+            emitOp(ops, call)->u[0] = GL_POLYGON_OFFSET_LINE;
+            emitOp(ops, call)->u[0] = GL_POLYGON_OFFSET_POINT;
+            break;
+        case GPUPipelineCapability::CAPABILITY_DEPTH_READ_ONLY:
+            emitOp(ops, GLStateCall::STATE_CALL_DEPTH_MASK)->u[0] =
+                (enable) ? GL_FALSE : GL_TRUE;
+            break;
+        case GPUPipelineCapability::CAPABILITY_STENCIL:
+            emitOp(ops, call)->u[0] = GL_STENCIL_TEST;
+            break;
+        case GPUPipelineCapability::CAPABILITY_SCISSOR:
+            emitOp(ops, call)->u[0] = GL_SCISSOR_TEST;
+            break;
+
+        case GPUPipelineCapability::CAPABILITY_PRIMITIVE_RESTART:
+            if (GLAD_GL_ARB_ES3_compatibility) {
+                emitOp(ops, call)->u[0] = GL_PRIMITIVE_RESTART_FIXED_INDEX;
+            } else if (glPrimitiveRestartIndex != nullptr) {
+                emitOp(ops, call)->u[0] = GL_PRIMITIVE_RESTART;
+                if (enable) emitOp(ops, GLStateCall::STATE_CALL_RESTART_INDEX)->u[0] = 0xFFFFFFFF;
+            }
+
+            break;
+        case GPUPipelineCapability::CAPABILITY_RASTERIZE_DISCARD:
+            emitOp(ops, call)->u[0] = GL_RASTERIZER_DISCARD;
+            break;
+        case GPUPipelineCapability::CAPABILITY_MULTISAMPLE:
+            emitOp(ops, call)->u[0] = GL_MULTISAMPLE;
+            break;
+    }
+}
+
+// ---------------------------------
+// OpenGL State: Pipeline Operations
+// ---------------------------------
+
+void GLState::compilePipelineEffect(GLStateOps &ops, GLPipelineState &state0,
+    GLPipelineState &current0, GLPipelineEffect effect) {
+    GLPipelineState* state = &state0;
+    GLPipelineState* current = &current0;
+    GLStateOp* op = nullptr;
 
     switch (effect) {
         case GLPipelineEffect::PIPELINE_EFFECT_CAPABILITIES: {
@@ -22,16 +84,17 @@ void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
                 GPUPipelineCapability cap = static_cast<GPUPipelineCapability>(index);
 
                 // Enable or Disable Capability
-                if (((caps >> index) & 1) != 0)
-                    enableCapability(cap);
-                else disableCapability(cap);
+                emitCapability(ops, cap, ((caps >> index) & 1) != 0);
                 delta &= ~(1 << index);
             }
+
+            state->capabilities = caps;
         } break;
 
         case GLPipelineEffect::PIPELINE_EFFECT_PROGRAM: {
             GLProgram *program = current->program;
-            glUseProgram(program->m_program);
+            op = emitOp(ops, GLStateCall::STATE_CALL_USE_PROGRAM);
+            op->u[0] = (program) ? program->m_program : 0;
             state->program = program;
         } break;
 
@@ -42,25 +105,31 @@ void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
             // Check Blending Equation Changes
             if (memcmp(&blend0->equation, &blend1->equation, sizeof(blend0->equation)) != 0) {
                 auto eq = &blend1->equation;
-                glBlendEquationSeparate(toValue(eq->rgb), toValue(eq->alpha));
+                op = emitOp(ops, GLStateCall::STATE_CALL_BLEND_EQUATION);
+                op->u[0] = toValue(eq->rgb);
+                op->u[1] = toValue(eq->alpha);
                 blend0->equation = blend1->equation;
             }
 
             // Check Blending Factor Changes
             if (memcmp(&blend0->factor, &blend1->factor, sizeof(blend0->factor)) != 0) {
                 auto factor = &blend1->factor;
-                glBlendFuncSeparate(
-                    toValue(factor->srcRGB),
-                    toValue(factor->dstRGB),
-                    toValue(factor->srcAlpha),
-                    toValue(factor->srcRGB));
+                op = emitOp(ops, GLStateCall::STATE_CALL_BLEND_FUNC);
+                op->u[0] = toValue(factor->srcRGB);
+                op->u[1] = toValue(factor->dstRGB);
+                op->u[2] = toValue(factor->srcAlpha);
+                op->u[3] = toValue(factor->dstAlpha);
                 blend0->factor = blend1->factor;
             }
 
             // Check Blending Color Changes
             if (memcmp(&blend0->color, &blend1->color, sizeof(blend0->color)) != 0) {
                 auto color = &blend1->color;
-                glBlendColor(color->r, color->g, color->b, color->a);
+                op = emitOp(ops, GLStateCall::STATE_CALL_BLEND_COLOR);
+                op->f[0] = color->r;
+                op->f[1] = color->g;
+                op->f[2] = color->b;
+                op->f[3] = color->a;
                 blend0->color = blend1->color;
             }
         } break;
@@ -71,8 +140,8 @@ void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
 
             // Change OpenGL Culling
             if (memcmp(cull0, cull1, sizeof(GPUPipelineFace)) != 0) {
-                glCullFace(toValue(cull1->mode));
-                glFrontFace(toValue(cull1->winding));
+                emitOp(ops, GLStateCall::STATE_CALL_CULL_FACE)->u[0] = toValue(cull1->mode);
+                emitOp(ops, GLStateCall::STATE_CALL_FRONT_FACE)->u[0] = toValue(cull1->winding);
                 state->culling = current->culling;
             }
         } break;
@@ -83,9 +152,13 @@ void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
 
             // Change OpenGL Depth
             if (memcmp(depth0, depth1, sizeof(GPUPipelineDepth)) != 0) {
-                glDepthFunc(toValue(depth1->condition));
-                glDepthRange(depth1->range.nearMin, depth1->range.farMax);
-                glPolygonOffset(depth1->offset.factor, depth1->offset.units);
+                emitOp(ops, GLStateCall::STATE_CALL_DEPTH_FUNC)->u[0] = toValue(depth1->condition);
+                op = emitOp(ops, GLStateCall::STATE_CALL_DEPTH_RANGE);
+                op->f[0] = depth1->range.nearMin;
+                op->f[1] = depth1->range.farMax;
+                op = emitOp(ops, GLStateCall::STATE_CALL_POLYGON_OFFSET);
+                op->f[0] = depth1->offset.factor;
+                op->f[1] = depth1->offset.units;
                 state->depth = current->depth;
             }
         } break;
@@ -97,85 +170,156 @@ void GLState::resolvePipelineEffect(GLPipelineEffect effect) {
             // Check Stencil Function Changes
             if (memcmp(&stencil0->function, &stencil1->function, sizeof(stencil0->function)) != 0) {
                 auto func = &stencil1->function;
-                glStencilFuncSeparate(
-                    toValue(func->face),
-                    toValue(func->condition),
-                    func->test,
-                    func->mask);
+                op = emitOp(ops, GLStateCall::STATE_CALL_STENCIL_FUNC);
+                op->u[0] = toValue(func->face);
+                op->u[1] = toValue(func->condition);
+                op->u[2] = func->test;
+                op->u[3] = func->mask;
                 stencil0->function = stencil1->function;
             }
 
             // Check Stencil Mask Changes
             if (memcmp(&stencil0->mask, &stencil1->mask, sizeof(stencil0->mask)) != 0) {
                 auto mask = &stencil1->mask;
-                glStencilMaskSeparate(GL_FRONT, mask->front);
-                glStencilMaskSeparate(GL_BACK, mask->back);
+                op = emitOp(ops, GLStateCall::STATE_CALL_STENCIL_MASK);
+                op->u[0] = GL_FRONT;
+                op->u[1] = mask->front;
+                op = emitOp(ops, GLStateCall::STATE_CALL_STENCIL_MASK);
+                op->u[0] = GL_BACK;
+                op->u[1] = mask->back;
                 stencil0->mask = stencil1->mask;
             }
 
             // Check Stencil Mode Changes
             if (memcmp(&stencil0->mode, &stencil1->mode, sizeof(stencil0->mode)) != 0) {
                 auto mode = &stencil1->mode;
-                glStencilOpSeparate(
-                    toValue(mode->face),
-                    toValue(mode->fail),
-                    toValue(mode->pass),
-                    toValue(mode->pass_depth));
+                op = emitOp(ops, GLStateCall::STATE_CALL_STENCIL_OP);
+                op->u[0] = toValue(mode->face);
+                op->u[1] = toValue(mode->fail);
+                op->u[2] = toValue(mode->pass);
+                op->u[3] = toValue(mode->pass_depth);
                 stencil0->mode = stencil1->mode;
             }
         } break;
 
         // -- OpenGL Viewport State --
         case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_DEPTH: {
-            glClearDepth(current->clear_depth);
+            emitOp(ops, GLStateCall::STATE_CALL_CLEAR_DEPTH)->f[0] = current->clear_depth;
             state->clear_depth = current->clear_depth;
         } break;
         case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_STENCIL: {
-            glClearStencil(current->clear_stencil);
+            emitOp(ops, GLStateCall::STATE_CALL_CLEAR_STENCIL)->i[0] = current->clear_stencil;
             state->clear_stencil = current->clear_stencil;
         } break;
         case GLPipelineEffect::PIPELINE_EFFECT_CLEAR_COLOR: {
             GPUColor color = current->clear_color;
-            glClearColor(color.r, color.g, color.b, color.a);
+            op = emitOp(ops, GLStateCall::STATE_CALL_CLEAR_COLOR);
+            op->f[0] = color.r;
+            op->f[1] = color.g;
+            op->f[2] = color.b;
+            op->f[3] = color.a;
             state->clear_color = color;
         } break;
         case GLPipelineEffect::PIPELINE_EFFECT_COLOR_MASK: {
             GPUColorMask mask = current->color_mask;
-            glColorMask(mask.r, mask.g, mask.b, mask.a);
+            op = emitOp(ops, GLStateCall::STATE_CALL_COLOR_MASK);
+            op->u[0] = mask.r;
+            op->u[1] = mask.g;
+            op->u[2] = mask.b;
+            op->u[3] = mask.a;
             state->color_mask = mask;
         } break;
 
         case GLPipelineEffect::PIPELINE_EFFECT_VIEWPORT: {
             GPURectangle rect = current->viewport;
-            glViewport(rect.x, rect.y, rect.w, rect.h);
+            op = emitOp(ops, GLStateCall::STATE_CALL_VIEWPORT);
+            op->i[0] = rect.x;
+            op->i[1] = rect.y;
+            op->i[2] = rect.w;
+            op->i[3] = rect.h;
             state->viewport = current->viewport;
         } break;
         case GLPipelineEffect::PIPELINE_EFFECT_SCISSOR: {
             GPURectangle rect = current->scissor;
-            glScissor(rect.x, rect.y, rect.w, rect.h);
+            op = emitOp(ops, GLStateCall::STATE_CALL_SCISSOR);
+            op->i[0] = rect.x;
+            op->i[1] = rect.y;
+            op->i[2] = rect.w;
+            op->i[3] = rect.h;
             state->scissor = current->scissor;
         } break;
 
         case GLPipelineEffect::PIPELINE_EFFECT_LINE_WIDTH: {
-            glLineWidth(current->line_width);
+            emitOp(ops, GLStateCall::STATE_CALL_LINE_WIDTH)->f[0] = current->line_width;
             state->line_width = current->line_width;
         } break;
     }
 }
 
+void GLState::executeStateOps(GLStateOp* ops, int count) {
+    for (int i = 0; i < count; i++) {
+        GLStateOp* op = ops + i;
+
+        switch (op->call) {
+            case GLStateCall::STATE_CALL_ENABLE: glEnable(op->u[0]); break;
+            case GLStateCall::STATE_CALL_DISABLE: glDisable(op->u[0]); break;
+            case GLStateCall::STATE_CALL_USE_PROGRAM: glUseProgram(op->u[0]); break;
+            case GLStateCall::STATE_CALL_BLEND_EQUATION:
+                glBlendEquationSeparate(op->u[0], op->u[1]); break;
+            case GLStateCall::STATE_CALL_BLEND_FUNC:
+                glBlendFuncSeparate(op->u[0], op->u[1], op->u[2], op->u[3]); break;
+            case GLStateCall::STATE_CALL_BLEND_COLOR:
+                glBlendColor(op->f[0], op->f[1], op->f[2], op->f[3]); break;
+            case GLStateCall::STATE_CALL_CULL_FACE: glCullFace(op->u[0]); break;
+            case GLStateCall::STATE_CALL_FRONT_FACE: glFrontFace(op->u[0]); break;
+            case GLStateCall::STATE_CALL_DEPTH_FUNC: glDepthFunc(op->u[0]); break;
+            case GLStateCall::STATE_CALL_DEPTH_RANGE: glDepthRange(op->f[0], op->f[1]); break;
+            case GLStateCall::STATE_CALL_DEPTH_MASK: glDepthMask(op->u[0]); break;
+            case GLStateCall::STATE_CALL_POLYGON_OFFSET: glPolygonOffset(op->f[0], op->f[1]); break;
+            case GLStateCall::STATE_CALL_RESTART_INDEX: glPrimitiveRestartIndex(op->u[0]); break;
+            case GLStateCall::STATE_CALL_STENCIL_FUNC:
+                glStencilFuncSeparate(op->u[0], op->u[1], op->i[2], op->u[3]); break;
+            case GLStateCall::STATE_CALL_STENCIL_MASK:
+                glStencilMaskSeparate(op->u[0], op->u[1]); break;
+            case GLStateCall::STATE_CALL_STENCIL_OP:
+                glStencilOpSeparate(op->u[0], op->u[1], op->u[2], op->u[3]); break;
+
+            // OpenGL Viewport State
+            case GLStateCall::STATE_CALL_CLEAR_DEPTH: glClearDepth(op->f[0]); break;
+            case GLStateCall::STATE_CALL_CLEAR_STENCIL: glClearStencil(op->i[0]); break;
+            case GLStateCall::STATE_CALL_CLEAR_COLOR:
+                glClearColor(op->f[0], op->f[1], op->f[2], op->f[3]); break;
+            case GLStateCall::STATE_CALL_COLOR_MASK:
+                glColorMask(op->u[0], op->u[1], op->u[2], op->u[3]); break;
+            case GLStateCall::STATE_CALL_VIEWPORT:
+                glViewport(op->i[0], op->i[1], op->i[2], op->i[3]); break;
+            case GLStateCall::STATE_CALL_SCISSOR:
+                glScissor(op->i[0], op->i[1], op->i[2], op->i[3]); break;
+            case GLStateCall::STATE_CALL_LINE_WIDTH: glLineWidth(op->f[0]); break;
+        }
+    }
+}
+
+// -------------------------------
+// OpenGL State: Pipeline Resolves
+// -------------------------------
+
 void GLState::resolvePipelineEffects() {
     if (m_pipeline_effects == 0)
         return;
 
-    // Resolve Pipeline Flags
+    // Compile Pipeline Flags
+    GLStateOps ops; ops.count = 0;
+    GLPipelineState* current = &m_pipeline_current->m_object->state;
     unsigned int effects = m_pipeline_effects;
     while (effects != 0) {
         unsigned int index = __builtin_ctz(effects);
         GLPipelineEffect effect = static_cast<GLPipelineEffect>(index);
-        resolvePipelineEffect(effect);
+        compilePipelineEffect(ops, m_pipeline_state, *current, effect);
         effects &= ~(1 << index);
     }
 
     // Replace Pipeline Effects
+    executeStateOps(ops.ops, ops.count);
     m_pipeline_effects = effects;
 }
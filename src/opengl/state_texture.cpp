@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include <nogpu_private.h>
+#include "private/commands.h"
+#include "private/program.h"
+#include "private/texture.h"
+#include "private/glad.h"
+#include <cstdlib>
+
+void GLState::prepareTextureUnits(unsigned int count) {
+    m_texture_units = (GLTextureUnit*) calloc(count, sizeof(GLTextureUnit));
+    m_texture_units_count = (m_texture_units) ? count : 0;
+    m_texture_tick = 0;
+}
+
+void GLState::disposeTextureUnits() {
+    free(m_texture_units);
+    m_texture_units = nullptr;
+    m_texture_units_count = 0;
+}
+
+void GLState::residentTexture(GLTexture* texture, unsigned int unit) {
+    if (unit >= m_texture_units_count)
+        return;
+
+    // Replace Texture Unit Residency
+    GLTextureUnit* slot = m_texture_units + unit;
+    slot->texture = texture;
+    slot->tick = m_texture_tick;
+    texture->m_tex_unit = unit;
+}
+
+void GLState::evictTexture(GLTexture* texture) {
+    for (unsigned int i = 0; i < m_texture_units_count; i++) {
+        GLTextureUnit* slot = m_texture_units + i;
+        if (slot->texture != texture)
+            continue;
+
+        // Forget Destroyed Texture
+        slot->texture = nullptr;
+        slot->tick = 0;
+    }
+}
+
+// ---------------------------------
+// OpenGL State: Texture Unit Select
+// ---------------------------------
+
+int GLState::resolveTextureUnit(GLTexture* texture) {
+    GLCommandsCounters* counters = &m_commands_counters;
+    int unit = texture->m_tex_unit;
+    // Reuse Texture Unit when Already Resident
+    if (unit >= 0 && unit < (int) m_texture_units_count &&
+        m_texture_units[unit].texture == texture) {
+            m_texture_units[unit].tick = m_texture_tick;
+            counters->texture_hits++;
+            return unit;
+        }
+
+    // Find Least Recently Used Texture Unit
+    GLCommandsState* current = &m_commands_current->m_state;
+    GLTextureUnit* victim = nullptr;
+    for (unsigned int i = 0; i < m_texture_units_count; i++) {
+        GLTextureUnit* check = m_texture_units + i;
+        // Avoid Units Used by Current Draw or by useTexture
+        if (check->tick == m_texture_tick || current->texture_actives.get_key(i))
+            continue;
+        if (victim == nullptr || check->tick < victim->tick)
+            victim = check;
+    }
+
+    if (victim == nullptr) {
+        GPUReport::error("no texture units available for samplers");
+        return -1;
+    }
+
+    // Bind Texture to Evicted Texture Unit
+    GLTextureActive active;
+    active.texture = texture;
+    active.unit = victim - m_texture_units;
+    glActiveTexture(GL_TEXTURE0 + active.unit);
+    glBindTexture(texture->m_tex_target, texture->m_tex);
+    m_commands_state.texture_actives.replace_key(active.unit, active);
+    residentTexture(texture, active.unit);
+    counters->texture_misses++;
+    counters->binds++;
+    return active.unit;
+}
+
+void GLState::resolveTextureSamplers() {
+    GLCommandsState* current = &m_commands_current->m_state;
+    GLProgram* program = m_pipeline_state.program;
+    m_texture_tick++;
+
+    for (GLTextureSampler binding : current->texture_samplers) {
+        GLUniform* uniform = binding.sampler;
+        if (uniform->m_program != program)
+            continue;
+
+        int unit = resolveTextureUnit(binding.texture);
+        if (unit < 0) return;
+        // Patch Sampler Uniform when Unit Changed
+        if (uniform->m_value[0] != (unsigned int) unit) {
+            glUniform1i(uniform->m_uniform, unit);
+            uniform->m_value[0] = unit;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include "private/state.hpp"
+#include "private/pipeline.h"
+#include <cstdlib>
+#include <cstring>
+
+GLPipelineTransition* GLState::findPipelineTransition(GLPipelineObject* from, GLPipelineObject* to) {
+    GLPipelineTransition* found = nullptr;
+    GLPipelineTransition* victim = m_pipeline_transitions;
+    m_pipeline_tick++;
+
+    // Find Transition or Least Recently Used
+    for (int i = 0; i < GL_PIPELINE_TRANSITIONS; i++) {
+        GLPipelineTransition* check = m_pipeline_transitions + i;
+        if (check->from == from && check->to == to) {
+            found = check;
+            break;
+        } else if (check->tick < victim->tick)
+            victim = check;
+    }
+
+    if (found != nullptr) {
+        found->tick = m_pipeline_tick;
+        return found;
+    }
+
+    // Compile Pipeline Transition
+    GLStateOps ops; ops.count = 0;
+    GLPipelineState state = from->state;
+    unsigned int effects = diffPipelineObjects(from, to);
+    while (effects != 0) {
+        unsigned int index = __builtin_ctz(effects);
+        GLPipelineEffect effect = static_cast<GLPipelineEffect>(index);
+        compilePipelineEffect(ops, state, to->state, effect);
+        effects &= ~(1 << index);
+    }
+
+    // Replace Least Recently Used
+    int bytes = sizeof(GLStateOp) * ops.count;
+    victim->ops = (GLStateOp*) realloc(victim->ops, bytes + sizeof(GLStateOp));
+    memcpy(victim->ops, ops.ops, bytes);
+    victim->count = ops.count;
+    victim->from = from;
+    victim->to = to;
+    victim->tick = m_pipeline_tick;
+    return victim;
+}
+
+void GLState::purgePipelineTransitions(GLPipelineObject* object) {
+    for (int i = 0; i < GL_PIPELINE_TRANSITIONS; i++) {
+        GLPipelineTransition* check = m_pipeline_transitions + i;
+        if (check->from != object && check->to != object)
+            continue;
+
+        // Forget Transition but Keep Allocation
+        check->from = nullptr;
+        check->to = nullptr;
+        check->count = 0;
+        check->tick = 0;
+    }
+}
+
+void GLState::disposePipelineTransitions() {
+    for (int i = 0; i < GL_PIPELINE_TRANSITIONS; i++) {
+        GLPipelineTransition* check = m_pipeline_transitions + i;
+        free(check->ops);
+        // Forget Transition
+        *check = GLPipelineTransition{};
+    }
+}
+
+// ---------------------------------
+// OpenGL State: Pipeline Transition
+// ---------------------------------
+
+void GLState::resolvePipelineTransition() {
+    GLPipelineObject* from = m_pipeline_applied;
+    GLPipelineObject* to = m_pipeline_current->m_object;
+    // Fallback to Pipeline Effects when Unknown
+    if (from == nullptr) {
+        resolvePipelineEffects();
+        return;
+    }
+
+    // Replay Precompiled Transition
+    if (from != to) {
+        GLPipelineTransition* transition = findPipelineTransition(from, to);
+        executeStateOps(transition->ops, transition->count);
+        m_pipeline_state = to->state;
+    }
+
+    // Applied State Already Matches
+    m_pipeline_effects = 0;
+}
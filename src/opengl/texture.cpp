@@ -6,20 +6,25 @@
 #include "private/glad.h"
 
 GLTexture::GLTexture(GLContext* ctx) {
-    ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = ctx->makeCurrentTexture(this);
 
     // Generate OpenGL Texture
     glGenTextures(1, &m_tex);
     m_tex_fbo = 0;
+    m_tex_unit = -1;
     m_ctx = ctx;
 }
 
 void GLTexture::destroy() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Destroy OpenGL Texture
     if (m_tex_fbo) glDeleteFramebuffers(1, &m_tex_fbo);
     if (m_tex) glDeleteTextures(1, &m_tex);
+    GLState* state = m_ctx->manipulateState();
+    state->clobberCommandsEffect(GLCommandsEffect::CMD_EFFECT_TEXTURE_ACTIVE);
+    state->evictTexture(this);
+    state->invalidateBundles(this);
     m_ctx = nullptr;
     // Dealloc Object
     delete this;
@@ -30,7 +35,7 @@ void GLTexture::destroy() {
 // -------------------------
 
 void GLTexture::setTransferSize(GPUTextureTransferSize size) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Check if Pixel Type has transfer mode not fixed
     if (!canTransferChange(m_pixel_type)) {
         GPUReport::error("transfer size cannot be changed");
@@ -42,7 +47,7 @@ void GLTexture::setTransferSize(GPUTextureTransferSize size) {
 }
 
 void GLTexture::setTransferFormat(GPUTextureTransferFormat format) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     // Check if Pixel Type has transfer mode not fixed
     if (!canTransferChange(m_pixel_type)) {
         GPUReport::error("transfer format cannot be changed");
@@ -54,7 +59,7 @@ void GLTexture::setTransferFormat(GPUTextureTransferFormat format) {
 }
 
 void GLTexture::setSwizzle(GPUTextureSwizzle swizzle) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     m_swizzle = swizzle;
 
     // Change Texture Swizzle
@@ -67,7 +72,7 @@ void GLTexture::setSwizzle(GPUTextureSwizzle swizzle) {
 }
 
 void GLTexture::setFilter(GPUTextureFilter filter) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     m_filter = filter;
 
     // Change Texture Filter
@@ -78,7 +83,7 @@ void GLTexture::setFilter(GPUTextureFilter filter) {
 }
 
 void GLTexture::setWrap(GPUTextureWrap wrap) {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     m_wrap = wrap;
 
     // Change Texture Wrapping
@@ -94,7 +99,7 @@ void GLTexture::setWrap(GPUTextureWrap wrap) {
 // ---------------------------------
 
 void GLTexture::generateTexture() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     GLenum target = m_tex_target;
     glBindTexture(target, m_tex);
 
@@ -109,7 +114,7 @@ void GLTexture::generateTexture() {
 }
 
 void GLTexture::generateMipmaps() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
 
     // Generate Texture Mipmaps
     GLenum target = m_tex_target;
@@ -122,6 +127,6 @@ void GLTexture::generateMipmaps() {
 // -------------------------
 
 GPUFence* GLTexture::syncFence() {
-    m_ctx->makeCurrentTexture(this);
+    GPUTraceScope trace = m_ctx->makeCurrentTexture(this);
     return m_ctx->syncFence();
 }
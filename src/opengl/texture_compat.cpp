@@ -2,6 +2,7 @@
 // Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
 #include <nogpu_private.h>
 #include "private/texture.h"
+#include "private/context.h"
 #include "private/glad.h"
 
 // -----------------------------------
@@ -30,6 +31,7 @@ void GLTexture::compatDownload3D(int x, int y, int z, int w, int h, int depth, i
 
     GLenum attachment = downloadAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_READ_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTextureLayer(GL_READ_FRAMEBUFFER,
         attachment, m_tex, level, z);
 
@@ -62,6 +64,7 @@ void GLTexture::compatDownload2D(int x, int y, int w, int h, int level, void* da
 
     GLenum attachment = downloadAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_READ_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTexture2D(GL_READ_FRAMEBUFFER,
         attachment, m_tex_target, m_tex, level);
 
@@ -86,6 +89,7 @@ void GLTexture::compatDownload1D(int x, int size, int level, void* data) {
 
     GLenum attachment = downloadAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_READ_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTexture1D(GL_READ_FRAMEBUFFER,
         attachment, GL_TEXTURE_1D, m_tex, level);
 
@@ -155,6 +159,7 @@ void GLTexture::compatClear3D(int x, int y, int z, int w, int h, int depth, int
 
     GLenum attachment = clearAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTextureLayer(GL_DRAW_FRAMEBUFFER,
         attachment, m_tex, level, z);
 
@@ -185,6 +190,7 @@ void GLTexture::compatClear2D(int x, int y, int w, int h, int level) {
 
     GLenum attachment = clearAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER,
         attachment, m_tex_target, m_tex, level);
 
@@ -210,6 +216,7 @@ void GLTexture::compatClear1D(int x, int size, int level) {
 
     GLenum attachment = clearAttachmentType(m_pixel_type);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_tex_fbo);
+    m_ctx->manipulateState()->clobberFrameBuffers();
     glFramebufferTexture1D(GL_DRAW_FRAMEBUFFER,
         attachment, GL_TEXTURE_1D, m_tex, level);
 
@@ -15,6 +15,15 @@ const char* debug_headers[] = {
     "\e[0;37m[nogpu: log]\033[0m",
 };
 
+const char* plain_headers[] = {
+    "[nogpu: info]",
+    "[nogpu: ok]",
+    "[nogpu: warning]",
+    "[nogpu: error]",
+    "[nogpu: assert]",
+    "[nogpu: log]",
+};
+
 #if defined(__i386__) || defined(__x86_64__)
     #define __nogpu_trap() __asm__ volatile ("int $0x03")
 #elif defined(__arm__)
@@ -30,17 +39,22 @@ const char* debug_headers[] = {
 // GPU Report State
 // ----------------
 
-void GPUReport::setMessage(GPUDebugLevel level, const char* message, int size) {
+void GPUReport::dispatchMessage(GPUDebugLevel level, void* object, const char* message, int size) {
     // Dispatch Message Reporting
     switch (m_report.m_mode) {
         case GPUDriverMode::DRIVER_MODE_LOGGER:
         case GPUDriverMode::DRIVER_MODE_DEBUG: {
             const int lvl = static_cast<int>(level);
-            const char* head = debug_headers[lvl];
+            FILE* file = m_report.m_file;
+            const char* head = (file != nullptr) ?
+                plain_headers[lvl] : debug_headers[lvl];
+            if (file == nullptr)
+                file = stdout;
+
             // Output Debug Message
-            if (m_report.m_object != nullptr)
-                printf("%s [%p] %s\n", head, m_report.m_object, message);
-            else printf("%s %s\n", head, message);
+            if (object != nullptr)
+                fprintf(file, "%s [%p] %s\n", head, object, message);
+            else fprintf(file, "%s %s\n", head, message);
             if (m_report.m_mode == GPUDriverMode::DRIVER_MODE_LOGGER)
                 break;
 
@@ -61,7 +75,7 @@ void GPUReport::setMessage(GPUDebugLevel level, const char* message, int size) {
             if (m_report.m_callback != nullptr) {
                 GPUDebugReport re{};
                 // Prepare Callback Message
-                re.object = m_report.m_object;
+                re.object = object;
                 re.message = message;
                 re.message_size = size;
                 re.level = level;
@@ -74,13 +88,27 @@ void GPUReport::setMessage(GPUDebugLevel level, const char* message, int size) {
     }
 }
 
+void GPUReport::setMessage(GPUDebugLevel level, const char* message, int size) {
+    void* object = m_report.m_object;
+    // Debug Mode Breakpoints are Synchronous
+    if (m_report.m_mode != GPUDriverMode::DRIVER_MODE_DEBUG)
+        if (pushMessage(level, object, message, size))
+            return;
+
+    // Dispatch Message Now
+    dispatchMessage(level, object, message, size);
+}
+
 static void setMessageFormat(GPUDebugLevel level, const char *format, va_list args) {
     if (GPUReport::getEnabled() == false)
         return;
+    // Defer Formatting to Drain Thread
+    if (GPUReport::pushFormat(level, format, args))
+        return;
 
     va_list tmp;
     va_copy(tmp, args);
-    static char buffer[256];
+    char buffer[256];
     char* message = buffer;
     // Output Message to Temporal Buffer
     int len = vsnprintf(message, 256, format, tmp);
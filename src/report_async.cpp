@@ -0,0 +1,516 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include "nogpu_private.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+#define REPORT_RING_BYTES 65536
+#define REPORT_RING_ALIGN 16
+#define REPORT_RING_MESSAGE 16384
+#define REPORT_DRAIN_MS 4
+#define REPORT_ARGS_BYTES 512
+#define REPORT_SPEC_BYTES 32
+
+typedef struct {
+    unsigned int bytes;
+    int level;
+    void* object;
+    const char* format;
+    int size;
+    char message[0];
+} GPUReportRecord;
+
+enum class GPUReportArg : int {
+    ARG_NONE,
+    ARG_INVALID,
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_LDOUBLE,
+    ARG_POINTER,
+    ARG_STRING,
+};
+
+typedef struct {
+    GPUReportArg arg;
+    int stars;
+    int length;
+} GPUReportSpec;
+
+typedef struct GPUReportRing {
+    struct GPUReportRing* next;
+    std::atomic<bool> owned;
+    std::atomic<unsigned int> head;
+    std::atomic<unsigned int> tail;
+    alignas(REPORT_RING_ALIGN) unsigned char data[REPORT_RING_BYTES];
+} GPUReportRing;
+
+typedef struct GPUReportOwner {
+    GPUReportRing* ring;
+    // Release Ring when Thread Exits
+    ~GPUReportOwner() {
+        if (ring != nullptr)
+            ring->owned.store(false, std::memory_order_release);
+    }
+} GPUReportOwner;
+
+static std::atomic<GPUReportRing*> g_rings(nullptr);
+static std::atomic<unsigned int> g_dropped(0);
+static std::atomic<bool> g_running(false);
+static thread_local GPUReportOwner g_owner = {};
+// Drain Thread Consumer
+static std::mutex g_drain_mutex;
+static std::condition_variable g_drain_cond;
+static std::thread* g_drain_thread = nullptr;
+
+// ---------------------------------
+// GPU Report Async: Deferred Format
+// ---------------------------------
+
+static const char* parseSpec(const char* fmt, GPUReportSpec* spec) {
+    const char* start = fmt++;
+    spec->arg = GPUReportArg::ARG_INVALID;
+    spec->stars = 0;
+
+    // Skip Flags, Width and Precision
+    while (*fmt && strchr("-+ #0", *fmt)) fmt++;
+    if (*fmt == '*') { spec->stars++; fmt++; }
+    while (*fmt >= '0' && *fmt <= '9') fmt++;
+    if (*fmt == '.') {
+        fmt++;
+        if (*fmt == '*') { spec->stars++; fmt++; }
+        while (*fmt >= '0' && *fmt <= '9') fmt++;
+    }
+
+    // Parse Length Modifier
+    char mod0 = 0, mod1 = 0;
+    if (*fmt && strchr("hljztL", *fmt)) {
+        mod0 = *fmt++;
+        if ((mod0 == 'h' || mod0 == 'l') && *fmt == mod0)
+            mod1 = *fmt++;
+    }
+
+    // Parse Conversion Type
+    char conv = *fmt;
+    if (conv != 0) fmt++;
+    switch (conv) {
+        case '%': spec->arg = GPUReportArg::ARG_NONE; break;
+        case 'c': if (mod0 == 0) spec->arg = GPUReportArg::ARG_INT; break;
+        case 's': if (mod0 == 0) spec->arg = GPUReportArg::ARG_STRING; break;
+        case 'p': spec->arg = GPUReportArg::ARG_POINTER; break;
+        case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+            switch (mod0) {
+                case 0: case 'h': spec->arg = GPUReportArg::ARG_INT; break;
+                case 'l': spec->arg = (mod1) ?
+                    GPUReportArg::ARG_LLONG : GPUReportArg::ARG_LONG; break;
+                case 'z': spec->arg = GPUReportArg::ARG_SIZE; break;
+                case 'j': spec->arg = GPUReportArg::ARG_INTMAX; break;
+                case 't': spec->arg = GPUReportArg::ARG_PTRDIFF; break;
+                default: break;
+            } break;
+        case 'f': case 'F': case 'e': case 'E':
+        case 'g': case 'G': case 'a': case 'A':
+            spec->arg = (mod0 == 'L') ?
+                GPUReportArg::ARG_LDOUBLE : GPUReportArg::ARG_DOUBLE;
+            break;
+        // Unsupported Conversion
+        default: break;
+    }
+
+    // Return Next Character
+    spec->length = (int) (fmt - start);
+    return fmt;
+}
+
+template <typename T>
+static bool captureValue(char* data, int &size, T value) {
+    if (size + (int) sizeof(T) > REPORT_ARGS_BYTES)
+        return false;
+    // Copy Raw Argument
+    memcpy(data + size, &value, sizeof(T));
+    size += sizeof(T);
+    return true;
+}
+
+static int captureFormat(const char* fmt, char* data, va_list args) {
+    GPUReportSpec spec;
+    int size = 0;
+    bool check = true;
+
+    while (check && *fmt) {
+        if (*fmt != '%') {
+            fmt++;
+            continue;
+        }
+
+        // Capture Star Arguments
+        fmt = parseSpec(fmt, &spec);
+        for (int i = 0; check && i < spec.stars; i++)
+            check = captureValue(data, size, va_arg(args, int));
+        if (check == false) break;
+
+        switch (spec.arg) {
+            case GPUReportArg::ARG_NONE: break;
+            case GPUReportArg::ARG_INVALID: check = false; break;
+            case GPUReportArg::ARG_INT: check = captureValue(data, size, va_arg(args, int)); break;
+            case GPUReportArg::ARG_LONG: check = captureValue(data, size, va_arg(args, long)); break;
+            case GPUReportArg::ARG_LLONG: check = captureValue(data, size, va_arg(args, long long)); break;
+            case GPUReportArg::ARG_SIZE: check = captureValue(data, size, va_arg(args, size_t)); break;
+            case GPUReportArg::ARG_INTMAX: check = captureValue(data, size, va_arg(args, intmax_t)); break;
+            case GPUReportArg::ARG_PTRDIFF: check = captureValue(data, size, va_arg(args, ptrdiff_t)); break;
+            case GPUReportArg::ARG_DOUBLE: check = captureValue(data, size, va_arg(args, double)); break;
+            case GPUReportArg::ARG_LDOUBLE: check = captureValue(data, size, va_arg(args, long double)); break;
+            case GPUReportArg::ARG_POINTER: check = captureValue(data, size, va_arg(args, void*)); break;
+            case GPUReportArg::ARG_STRING: {
+                const char* str = va_arg(args, const char*);
+                if (str == nullptr) str = "(null)";
+                int len = (int) strlen(str) + 1;
+                // Copy String Contents
+                check = size + len <= REPORT_ARGS_BYTES;
+                if (check) {
+                    memcpy(data + size, str, len);
+                    size += len;
+                }
+            } break;
+        }
+    }
+
+    // Return Captured Bytes
+    return (check) ? size : -1;
+}
+
+// -------------------------------
+// GPU Report Async: Render Format
+// -------------------------------
+
+static char* g_render = nullptr;
+static int g_render_capacity = 0;
+
+static void renderReserve(int bytes) {
+    if (bytes <= g_render_capacity)
+        return;
+
+    int capacity = (g_render_capacity > 0) ? g_render_capacity : 256;
+    while (capacity < bytes)
+        capacity <<= 1;
+    // Grow Render Buffer
+    g_render = (char*) realloc(g_render, capacity);
+    g_render_capacity = capacity;
+}
+
+template <typename T>
+static T loadValue(const char* &data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    // Return Raw Argument
+    return value;
+}
+
+template <typename T>
+static void renderValue(int &len, const char* sub, int stars, int* star, T value) {
+    for (int i = 0; i < 2; i++) {
+        char* dst = g_render + len;
+        int n = g_render_capacity - len;
+        int count = 0;
+        // Render Value with Spec
+        switch (stars) {
+            case 0: count = snprintf(dst, n, sub, value); break;
+            case 1: count = snprintf(dst, n, sub, star[0], value); break;
+            default: count = snprintf(dst, n, sub, star[0], star[1], value); break;
+        }
+
+        // Grow Buffer and Retry
+        if (count < n) {
+            len += count;
+            return;
+        } renderReserve(len + count + 1);
+    }
+}
+
+static const char* renderFormat(const char* fmt, const char* data, int &size) {
+    GPUReportSpec spec;
+    char sub[REPORT_SPEC_BYTES];
+    int len = 0;
+    renderReserve(256);
+
+    while (*fmt) {
+        if (*fmt != '%') {
+            renderReserve(len + 2);
+            g_render[len++] = *fmt++;
+            continue;
+        }
+
+        // Copy Conversion Spec
+        const char* start = fmt;
+        fmt = parseSpec(fmt, &spec);
+        int length = spec.length;
+        if (length >= REPORT_SPEC_BYTES)
+            length = REPORT_SPEC_BYTES - 1;
+        memcpy(sub, start, length);
+        sub[length] = '\0';
+
+        // Load Star Arguments
+        int star[2] = {0, 0};
+        for (int i = 0; i < spec.stars; i++) {
+            memcpy(&star[i], data, sizeof(int));
+            data += sizeof(int);
+        }
+
+        switch (spec.arg) {
+            case GPUReportArg::ARG_NONE:
+            case GPUReportArg::ARG_INVALID:
+                renderReserve(len + 2);
+                g_render[len++] = '%';
+                break;
+            case GPUReportArg::ARG_INT: renderValue(len, sub, spec.stars, star, loadValue<int>(data)); break;
+            case GPUReportArg::ARG_LONG: renderValue(len, sub, spec.stars, star, loadValue<long>(data)); break;
+            case GPUReportArg::ARG_LLONG: renderValue(len, sub, spec.stars, star, loadValue<long long>(data)); break;
+            case GPUReportArg::ARG_SIZE: renderValue(len, sub, spec.stars, star, loadValue<size_t>(data)); break;
+            case GPUReportArg::ARG_INTMAX: renderValue(len, sub, spec.stars, star, loadValue<intmax_t>(data)); break;
+            case GPUReportArg::ARG_PTRDIFF: renderValue(len, sub, spec.stars, star, loadValue<ptrdiff_t>(data)); break;
+            case GPUReportArg::ARG_DOUBLE: renderValue(len, sub, spec.stars, star, loadValue<double>(data)); break;
+            case GPUReportArg::ARG_LDOUBLE: renderValue(len, sub, spec.stars, star, loadValue<long double>(data)); break;
+            case GPUReportArg::ARG_POINTER: renderValue(len, sub, spec.stars, star, loadValue<void*>(data)); break;
+            case GPUReportArg::ARG_STRING: {
+                const char* str = data;
+                data += strlen(str) + 1;
+                renderValue(len, sub, spec.stars, star, str);
+            } break;
+        }
+    }
+
+    // Return Rendered Message
+    g_render[len] = '\0';
+    size = len;
+    return g_render;
+}
+
+// ----------------------------
+// GPU Report Async: Ring Queue
+// ----------------------------
+
+static GPUReportRing* ringClaim() {
+    GPUReportRing* ring = g_rings.load(std::memory_order_acquire);
+    // Reuse Ring Released by Finished Thread
+    for (; ring != nullptr; ring = ring->next) {
+        bool expected = false;
+        if (ring->owned.compare_exchange_strong(expected, true,
+            std::memory_order_acquire))
+                return ring;
+    }
+
+    // Allocate New Ring
+    ring = new GPUReportRing;
+    ring->owned.store(true, std::memory_order_relaxed);
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->next = g_rings.load(std::memory_order_relaxed);
+    // Register Ring to Lock-free List
+    while (!g_rings.compare_exchange_weak(ring->next, ring,
+        std::memory_order_release, std::memory_order_relaxed));
+    return ring;
+}
+
+static bool ringPush(GPUReportRing* ring, GPUDebugLevel level, void* object,
+    const char* format, const char* message, int size) {
+    if (size > REPORT_RING_MESSAGE)
+        size = REPORT_RING_MESSAGE;
+    unsigned int bytes = sizeof(GPUReportRecord) + size + 1;
+    bytes = (bytes + REPORT_RING_ALIGN - 1) & ~(REPORT_RING_ALIGN - 1);
+
+    // Check Contiguous Space
+    const unsigned int mask = REPORT_RING_BYTES - 1;
+    unsigned int head = ring->head.load(std::memory_order_relaxed);
+    unsigned int tail = ring->tail.load(std::memory_order_acquire);
+    unsigned int contiguous = REPORT_RING_BYTES - (head & mask);
+    unsigned int pad = (bytes > contiguous) ? contiguous : 0;
+    if (head + pad + bytes - tail > REPORT_RING_BYTES) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Skip Ring Tail with Padding Record
+    if (pad > 0) {
+        GPUReportRecord* skip = (GPUReportRecord*) (ring->data + (head & mask));
+        skip->bytes = pad;
+        skip->level = -1;
+        head += pad;
+    }
+
+    // Copy Message to Record
+    GPUReportRecord* record = (GPUReportRecord*) (ring->data + (head & mask));
+    record->bytes = bytes;
+    record->level = static_cast<int>(level);
+    record->object = object;
+    record->format = format;
+    record->size = size;
+    memcpy(record->message, message, size);
+    record->message[size] = '\0';
+
+    // Publish Record to Consumer
+    ring->head.store(head + bytes, std::memory_order_release);
+    return true;
+}
+
+static void ringDrain(GPUReportRing* ring) {
+    const unsigned int mask = REPORT_RING_BYTES - 1;
+    unsigned int tail = ring->tail.load(std::memory_order_relaxed);
+    unsigned int head = ring->head.load(std::memory_order_acquire);
+
+    while (tail != head) {
+        GPUReportRecord* record = (GPUReportRecord*) (ring->data + (tail & mask));
+        if (record->level >= 0) {
+            GPUDebugLevel level = static_cast<GPUDebugLevel>(record->level);
+            const char* message = record->message;
+            int size = record->size;
+            // Render Deferred Arguments
+            if (record->format != nullptr)
+                message = renderFormat(record->format, record->message, size);
+            GPUReport::dispatchMessage(level, record->object, message, size);
+        }
+
+        // Release Record to Producer
+        tail += record->bytes;
+        ring->tail.store(tail, std::memory_order_release);
+    }
+}
+
+// -----------------------------
+// GPU Report Async: Drain Queue
+// -----------------------------
+
+static void drainRings() {
+    GPUReportRing* ring = g_rings.load(std::memory_order_acquire);
+    for (; ring != nullptr; ring = ring->next)
+        ringDrain(ring);
+}
+
+static void drainLoop() {
+    std::unique_lock<std::mutex> lock(g_drain_mutex);
+    while (g_running.load(std::memory_order_acquire)) {
+        drainRings();
+        g_drain_cond.wait_for(lock,
+            std::chrono::milliseconds(REPORT_DRAIN_MS));
+    }
+
+    // Drain Remaining Messages
+    drainRings();
+}
+
+static void drainStop() {
+    if (g_drain_thread == nullptr)
+        return;
+
+    // Wake and Join Drain Thread
+    g_running.store(false, std::memory_order_release);
+    g_drain_cond.notify_one();
+    g_drain_thread->join();
+    delete g_drain_thread;
+    g_drain_thread = nullptr;
+}
+
+// ---------------------------
+// GPU Report Async: Reporting
+// ---------------------------
+
+bool GPUReport::pushMessage(GPUDebugLevel level, void* object, const char* message, int size) {
+    if (g_running.load(std::memory_order_acquire) == false)
+        return false;
+
+    // Claim Thread Ring Once
+    GPUReportRing* ring = g_owner.ring;
+    if (ring == nullptr) {
+        ring = ringClaim();
+        g_owner.ring = ring;
+    }
+
+    // Dropped Messages are Counted
+    ringPush(ring, level, object, nullptr, message, size);
+    return true;
+}
+
+bool GPUReport::pushFormat(GPUDebugLevel level, const char* format, va_list args) {
+    if (g_running.load(std::memory_order_acquire) == false)
+        return false;
+    if (m_report.m_mode == GPUDriverMode::DRIVER_MODE_DEBUG)
+        return false;
+
+    // Capture Raw Arguments
+    char data[REPORT_ARGS_BYTES];
+    va_list tmp;
+    va_copy(tmp, args);
+    int size = captureFormat(format, data, tmp);
+    va_end(tmp);
+    if (size < 0)
+        return false;
+
+    // Claim Thread Ring Once
+    GPUReportRing* ring = g_owner.ring;
+    if (ring == nullptr) {
+        ring = ringClaim();
+        g_owner.ring = ring;
+    }
+
+    // Dropped Messages are Counted
+    ringPush(ring, level, m_report.m_object, format, data, size);
+    return true;
+}
+
+void GPUReport::setAsync(bool value) {
+    if (value == (g_drain_thread != nullptr))
+        return;
+
+    if (value) {
+        static bool registered = false;
+        if (registered == false) {
+            atexit(drainStop);
+            registered = true;
+        }
+
+        // Start Drain Thread
+        g_running.store(true, std::memory_order_release);
+        g_drain_thread = new std::thread(drainLoop);
+    } else drainStop();
+}
+
+void GPUReport::setFile(const char* filename) {
+    std::lock_guard<std::mutex> lock(g_drain_mutex);
+    drainRings();
+    // Close Previous File
+    if (m_report.m_file != nullptr) {
+        fclose(m_report.m_file);
+        m_report.m_file = nullptr;
+    }
+
+    // Open New File
+    if (filename != nullptr) {
+        m_report.m_file = fopen(filename, "w");
+        if (m_report.m_file == nullptr)
+            GPUReport::error("failed open report file: %s", filename);
+    }
+}
+
+unsigned int GPUReport::getDropped() {
+    return g_dropped.load(std::memory_order_relaxed);
+}
+
+void GPUReport::flush() {
+    std::lock_guard<std::mutex> lock(g_drain_mutex);
+    drainRings();
+    // Flush Output File
+    FILE* file = m_report.m_file;
+    fflush((file != nullptr) ? file : stdout);
+}
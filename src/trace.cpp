@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025 Cristian Camilo Ruiz <mrgaturus>
+#include "nogpu_trace.h"
+#include "nogpu_private.h"
+#include <chrono>
+#include <mutex>
+#include <cstdlib>
+
+#define TRACE_CHUNK_EVENTS 4096
+#define TRACE_CHUNK_MAX 256
+#define TRACE_RING_EVENTS (TRACE_CHUNK_EVENTS * TRACE_CHUNK_MAX)
+#define TRACE_CALIBRATE 1024
+
+typedef struct {
+    const char* name;
+    void* object;
+    unsigned long long begin;
+    unsigned long long end;
+} GPUTraceEvent;
+
+typedef struct GPUTraceBuffer {
+    struct GPUTraceBuffer* next;
+    unsigned int tid;
+    std::atomic<unsigned int> start;
+    std::atomic<bool> owned;
+    std::atomic<unsigned int> count;
+    GPUTraceEvent* chunks[TRACE_CHUNK_MAX];
+} GPUTraceBuffer;
+
+typedef struct GPUTraceOwner {
+    GPUTraceBuffer* buffer;
+    // Release Buffer when Thread Exits
+    ~GPUTraceOwner() {
+        if (buffer != nullptr)
+            buffer->owned.store(false, std::memory_order_release);
+    }
+} GPUTraceOwner;
+
+std::atomic<bool> GPUTrace::m_enabled(false);
+static std::atomic<GPUTraceBuffer*> g_buffers(nullptr);
+static std::atomic<unsigned int> g_threads(0);
+static std::atomic<unsigned int> g_dropped(0);
+static thread_local GPUTraceOwner g_owner = {};
+// Tracing Session
+static std::mutex g_export_mutex;
+static unsigned long long g_epoch = 0;
+static unsigned long long g_overhead = 0;
+
+// --------------------------
+// GPU Tracing: Thread Buffer
+// --------------------------
+
+static GPUTraceBuffer* bufferClaim() {
+    GPUTraceBuffer* buffer = g_buffers.load(std::memory_order_acquire);
+    // Reuse Buffer Released by Finished Thread
+    for (; buffer != nullptr; buffer = buffer->next) {
+        bool expected = false;
+        if (!buffer->owned.compare_exchange_strong(expected, true,
+            std::memory_order_acquire))
+                continue;
+
+        // Keep Buffer until Previous Thread Events are Exported
+        unsigned int count = buffer->count.load(std::memory_order_relaxed);
+        if (buffer->start.load(std::memory_order_acquire) != count) {
+            buffer->owned.store(false, std::memory_order_release);
+            continue;
+        }
+
+        // Identify New Thread
+        buffer->tid = g_threads.fetch_add(1, std::memory_order_relaxed) + 1;
+        return buffer;
+    }
+
+    // Allocate New Buffer
+    buffer = (GPUTraceBuffer*) calloc(1, sizeof(GPUTraceBuffer));
+    buffer->tid = g_threads.fetch_add(1, std::memory_order_relaxed) + 1;
+    buffer->owned.store(true, std::memory_order_relaxed);
+    buffer->start.store(0, std::memory_order_relaxed);
+    buffer->count.store(0, std::memory_order_relaxed);
+    buffer->next = g_buffers.load(std::memory_order_relaxed);
+    // Register Buffer to Lock-free List
+    while (!g_buffers.compare_exchange_weak(buffer->next, buffer,
+        std::memory_order_release, std::memory_order_relaxed));
+    return buffer;
+}
+
+void GPUTrace::record(const char* name, void* object, unsigned long long begin) {
+    unsigned long long end = GPUTrace::clock();
+    GPUTraceBuffer* buffer = g_owner.buffer;
+    if (buffer == nullptr) {
+        buffer = bufferClaim();
+        g_owner.buffer = buffer;
+    }
+
+    // Check Ring Capacity, Exported Events are Recycled
+    unsigned int count = buffer->count.load(std::memory_order_relaxed);
+    unsigned int start = buffer->start.load(std::memory_order_acquire);
+    if (count - start >= TRACE_RING_EVENTS) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Allocate Chunk when Needed
+    unsigned int chunk = (count % TRACE_RING_EVENTS) / TRACE_CHUNK_EVENTS;
+    GPUTraceEvent* events = buffer->chunks[chunk];
+    if (events == nullptr) {
+        events = (GPUTraceEvent*) malloc(sizeof(GPUTraceEvent) * TRACE_CHUNK_EVENTS);
+        buffer->chunks[chunk] = events;
+    }
+
+    // Publish Trace Event
+    GPUTraceEvent* event = events + (count % TRACE_CHUNK_EVENTS);
+    event->name = name;
+    event->object = object;
+    event->begin = begin;
+    event->end = end;
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+// -----------------------
+// GPU Tracing: Properties
+// -----------------------
+
+unsigned long long GPUTrace::clock() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+void GPUTrace::setEnabled(bool value) {
+    if (value && g_epoch == 0) {
+        g_epoch = GPUTrace::clock();
+        // Measure Clock Overhead per Scope
+        unsigned long long begin = GPUTrace::clock();
+        for (int i = 0; i < TRACE_CALIBRATE; i++)
+            GPUTrace::clock();
+        unsigned long long end = GPUTrace::clock();
+        g_overhead = ((end - begin) * 2) / TRACE_CALIBRATE;
+    }
+
+    // Change Tracing Status
+    m_enabled.store(value, std::memory_order_relaxed);
+}
+
+bool GPUTrace::getEnabled() {
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+// -------------------
+// GPU Tracing: Export
+// -------------------
+
+bool GPUTrace::exportChrome(const char* filename) {
+    std::lock_guard<std::mutex> lock(g_export_mutex);
+    FILE* file = fopen(filename, "w");
+    if (file == nullptr) {
+        GPUReport::error("failed open trace file: %s", filename);
+        return false;
+    }
+
+    bool first = true;
+    fprintf(file, "{\"traceEvents\":[\n");
+    GPUTraceBuffer* buffer = g_buffers.load(std::memory_order_acquire);
+    for (; buffer != nullptr; buffer = buffer->next) {
+        unsigned int count = buffer->count.load(std::memory_order_acquire);
+        unsigned int start = buffer->start.load(std::memory_order_relaxed);
+        // Write Complete Events
+        for (unsigned int idx = start; idx != count; idx++) {
+            unsigned int slot = idx % TRACE_RING_EVENTS;
+            GPUTraceEvent* events = buffer->chunks[slot / TRACE_CHUNK_EVENTS];
+            GPUTraceEvent* event = events + (slot % TRACE_CHUNK_EVENTS);
+            double ts = (double) (event->begin - g_epoch) / 1000.0;
+            double dur = (double) (event->end - event->begin) / 1000.0;
+            fprintf(file, "%s{\"name\":\"%s\",\"cat\":\"nogpu\",\"ph\":\"X\","
+                "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,"
+                "\"args\":{\"object\":\"%p\"}}",
+                (first) ? "" : ",\n", event->name, ts, dur, buffer->tid, event->object);
+            first = false;
+        }
+
+        // Recycle Exported Events
+        buffer->start.store(count, std::memory_order_release);
+    }
+
+    // Write Tracing Metadata
+    fprintf(file, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{"
+        "\"overhead_ns\":%llu,\"dropped\":%u}}\n",
+        g_overhead, g_dropped.load(std::memory_order_relaxed));
+    fclose(file);
+    return true;
+}